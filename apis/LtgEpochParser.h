@@ -0,0 +1,105 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+
+namespace Ltg {
+
+// parse datetimes in format "YYYY-MM-DD HH:MM:SS", "YYYY-MM-DD HH:MM:SS.ffffff" or "YYYY-MM-DD HH:MM:SS,ffffff"
+// to an epoch time in seconds. the datetime is considered as UTC, the hour offset is added
+// the digits after the seconds are a count of microseconds, like the std::get_time path of ltg:stringToEpoch
+// so ",464" is 464 us and ",464000" is 0.464 s
+// the "YYYY-MM-DD HH" part is memoized, since consecutive rows of a log share it mostly
+// no libc time functions are used, so can be used by many threads, with one instance per thread
+class EpochParser {
+private:
+    static constexpr size_t sc_PREFIX_SIZE = 13U;  // "YYYY-MM-DD HH"
+    char m_prefix[sc_PREFIX_SIZE] = {};
+    double m_prefixHourOffset = 0.0;
+    int64_t m_prefixSeconds = 0;
+    bool m_prefixValid = false;
+
+public:
+    // return false if the format is not supported
+    bool parse(const std::string_view& vDateTime, double vHourOffset, double& vOutEpoch) {
+        const char* str = vDateTime.data();
+        const size_t len = vDateTime.size();
+        if (len < 19U) {
+            return false;
+        }
+        if (!m_prefixValid || m_prefixHourOffset != vHourOffset || memcmp(m_prefix, str, sc_PREFIX_SIZE) != 0) {
+            int32_t year = 0, month = 0, day = 0, hour = 0;
+            if (!s_digits(str, 4U, year) || str[4] != '-' ||       //
+                !s_digits(str + 5, 2U, month) || str[7] != '-' ||  //
+                !s_digits(str + 8, 2U, day) ||                     //
+                (str[10] != ' ' && str[10] != 'T') ||              //
+                !s_digits(str + 11, 2U, hour)) {
+                m_prefixValid = false;
+                return false;
+            }
+            if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23) {
+                m_prefixValid = false;
+                return false;
+            }
+            memcpy(m_prefix, str, sc_PREFIX_SIZE);
+            m_prefixHourOffset = vHourOffset;
+            m_prefixSeconds = s_daysFromCivil(year, month, day) * 86400 + hour * 3600;
+            m_prefixValid = true;
+        }
+        int32_t minutes = 0, seconds = 0;
+        if (str[13] != ':' || !s_digits(str + 14, 2U, minutes) ||  //
+            str[16] != ':' || !s_digits(str + 17, 2U, seconds)) {
+            return false;
+        }
+        int64_t microseconds = 0;
+        if (len > 20U && (str[19] == '.' || str[19] == ',')) {
+            for (size_t idx = 20U; idx < len && idx < 38U && str[idx] >= '0' && str[idx] <= '9'; ++idx) {
+                microseconds = microseconds * 10 + (str[idx] - '0');
+            }
+        }
+        vOutEpoch = static_cast<double>(m_prefixSeconds + minutes * 60 + seconds) + vHourOffset * 3600.0 + static_cast<double>(microseconds) / 1000000.0;
+        return true;
+    }
+
+    // days since 1970-01-01 of a date of the proleptic gregorian calendar
+    static int64_t s_daysFromCivil(int64_t y, int64_t m, int64_t d) {
+        y -= (m <= 2) ? 1 : 0;
+        const int64_t era = ((y >= 0) ? y : y - 399) / 400;
+        const int64_t yoe = y - era * 400;
+        const int64_t doy = (153 * (m + ((m > 2) ? -3 : 9)) + 2) / 5 + d - 1;
+        const int64_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+        return era * 146097 + doe - 719468;
+    }
+
+private:
+    static bool s_digits(const char* vStr, size_t vCount, int32_t& vOutNumber) {
+        vOutNumber = 0;
+        for (size_t idx = 0U; idx < vCount; ++idx) {
+            const char c = vStr[idx];
+            if (c < '0' || c > '9') {
+                return false;
+            }
+            vOutNumber = vOutNumber * 10 + (c - '0');
+        }
+        return true;
+    }
+};
+
+}  // namespace Ltg
@@ -20,6 +20,7 @@ limitations under the License.
 #include <memory>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 #include <array>
 #include <map>
@@ -143,6 +144,17 @@ struct ScriptingError {
 };
 typedef std::vector<ScriptingError> ErrorContainer;
 
+// id of a registered signal
+typedef int32_t SignalHandle;
+
+// numerical value of a registered signal
+// the layout is shared with scripts (ex: LuaJIT ffi), so must not be changed
+struct SignalValueTick {
+    SignalHandle handle;
+    double epoch;
+    double value;
+};
+
 // lua_register(lua_state_ptr, "print", lua_int_print_args);
 struct IDatasModel {
     // add a signal tag with date, color a name. the help will be displayed when mouse over the tag
@@ -156,13 +168,36 @@ struct IDatasModel {
     virtual void addSignalStartZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStartMsg) = 0;
     // will add a signal end zone
     virtual void addSignalEndZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vEndMsg) = 0;
+    // will register a signal and return a handle for the handle based functions, or -1 if the category or the name is empty
+    virtual SignalHandle registerSignal(const std::string& vCategory, const std::string& vName) = 0;
+    // will add a signal numerical value for a registered signal
+    virtual void addSignalValue(SignalHandle vHandle, double vEpoch, double vValue) = 0;
+    // will add vCount signal numerical values for a registered signal
+    virtual void addSignalValues(SignalHandle vHandle, const double* vEpochs, const double* vValues, size_t vCount) = 0;
+    // will add vCount signal numerical values of any registered signals
+    virtual void addSignalValueTicks(const SignalValueTick* vTicks, size_t vCount) = 0;
+    // will add vCount signal numerical values
+    virtual void addSignalValues(const std::string& vCategory, const std::string& vName, const double* vEpochs, const double* vValues, size_t vCount) {
+        const auto handle = registerSignal(vCategory, vName);
+        if (handle >= 0) {
+            addSignalValues(handle, vEpochs, vValues, vCount);
+        }
+    }
 };
 
 typedef std::shared_ptr<IDatasModel> IDatasModelPtr;
 typedef std::weak_ptr<IDatasModel> IDatasModelWeak;
 
 struct ScriptingDatas {
-    std::string buffer;
+    // view on the current row, only valid during the callScriptExec call
+    std::string_view buffer;
+};
+struct ScriptingDatasBatch {
+    // views on the rows, only valid during the callScriptExecBatch call
+    const std::string_view* rows = nullptr;
+    size_t count = 0U;
+    // row index of rows[0] in the file
+    int32_t firstRowIndex = 0;
 };
 typedef std::string ScriptingModuleName;
 struct ScriptingModule : public PluginModule {
@@ -177,12 +212,27 @@ struct ScriptingModule : public PluginModule {
     virtual bool callScriptStart(ErrorContainer& vOutErrors) = 0;
     // will call the exec function from script with a buffer and return errors
     virtual bool callScriptExec(const ScriptingDatas& vOutDatas, ErrorContainer& vErrors) = 0;
+    // will call the exec function from script with many rows at once and return errors
+    // by default, will call callScriptExec for each row
+    virtual bool callScriptExecBatch(const ScriptingDatasBatch& vDatas, ErrorContainer& vErrors) {
+        bool res = true;
+        ScriptingDatas datas;
+        for (size_t idx = 0U; idx < vDatas.count; ++idx) {
+            setRowIndex(vDatas.firstRowIndex + static_cast<int32_t>(idx));
+            datas.buffer = vDatas.rows[idx];
+            res &= callScriptExec(datas, vErrors);
+        }
+        return res;
+    }
     // will call the end function from script and return errors
     virtual bool callScriptEnd(ErrorContainer& vOutErrors) = 0;
     // will set the row index
     virtual void setRowIndex(int32_t vRowIndex) = 0;
     // will set the row count
     virtual void setRowCount(int32_t vRowCount) = 0;
+    // return true if the script parse each row independently of the others
+    // so a file can be splitted and parsed by many module instances at same time
+    virtual bool isParallelSafe() const { return false; }
 };
 
 typedef std::shared_ptr<ScriptingModule> ScriptingModulePtr;
@@ -1,10 +1,14 @@
 #include <modules/LuaDatasModel.h>
 #include <ezlibs/ezTools.hpp>
 #include <ezlibs/ezLog.hpp>
+#include <algorithm>
 
 LuaDatasModelPtr LuaDatasModel::create(Ltg::IDatasModelWeak vIDatasModel) {
     auto res = std::make_shared<LuaDatasModel>();
     res->m_DatasModel = vIDatasModel;
+    res->m_Ticks.resize(sc_TICK_BUFFER_CAPACITY);
+    res->m_TickBuffer.capacity = sc_TICK_BUFFER_CAPACITY;
+    res->m_TickBuffer.ticks = res->m_Ticks.data();
     if (vIDatasModel.expired()) {
         res.reset();
     }
@@ -47,11 +51,31 @@ void LuaDatasModel::setRowCount(int32_t vRowCount) {
     m_RowCount = vRowCount;
 }
 
+LuaDatasModel::TickBuffer* LuaDatasModel::getTickBuffer() {
+    return &m_TickBuffer;
+}
+
+void LuaDatasModel::flushTicks() {
+    if (m_TickBuffer.count > 0) {
+        auto ptr = m_DatasModel.lock();
+        if (ptr != nullptr) {
+            const auto count = std::min(m_TickBuffer.count, m_TickBuffer.capacity);
+            ptr->addSignalValueTicks(m_TickBuffer.ticks, static_cast<size_t>(count));
+        }
+        m_TickBuffer.count = 0;
+    }
+}
+
 double LuaDatasModel::luaModuleGetRowCount() {
     return static_cast<double>(m_RowCount);
 }
 
 double LuaDatasModel::luaModuleStringToEpoch(const std::string& vDateTime, double vHourOffset) {
+    double epoch = 0.0;
+    if (m_EpochParser.parse(vDateTime, vHourOffset, epoch)) {
+        return epoch;
+    }
+    // not the fixed format, by ex "2023-1-6 5:4:3", so the slow path
     struct tm timeStruct = {};
     int microseconds = 0;
     std::istringstream dateStream(vDateTime);
@@ -60,15 +84,10 @@ double LuaDatasModel::luaModuleStringToEpoch(const std::string& vDateTime, doubl
     if (dateStream.fail()) {
         throw std::invalid_argument("Invalid date format");
     }
-    timeStruct.tm_hour += static_cast<int32_t>(vHourOffset);
-    timeStruct.tm_isdst = 1;
     dateStream >> delimiter >> microseconds;
-    std::time_t epochSeconds = std::mktime(&timeStruct);
-    if (epochSeconds == -1) {
-        throw std::runtime_error("Failed to convert to epoch time");
-    }
-    epochSeconds -= static_cast<time_t>(std::difftime(std::mktime(std::gmtime(&epochSeconds)), std::mktime(std::localtime(&epochSeconds))));
-    return static_cast<double>(epochSeconds) + static_cast<double>(microseconds) / 1000000.0;
+    const int64_t days = Ltg::EpochParser::s_daysFromCivil(timeStruct.tm_year + 1900, timeStruct.tm_mon + 1, timeStruct.tm_mday);
+    const int64_t epochSeconds = days * 86400 + timeStruct.tm_hour * 3600 + timeStruct.tm_min * 60 + timeStruct.tm_sec;
+    return static_cast<double>(epochSeconds) + vHourOffset * 3600.0 + static_cast<double>(microseconds) / 1000000.0;
 }
 
 std::string LuaDatasModel::luaModuleEpochToString(double vEpochTime, double vHourOffset) {
@@ -127,3 +146,32 @@ void LuaDatasModel::luaModuleAddSignalEndZone(const std::string& vCategory, cons
         ptr->addSignalEndZone(vCategory, vName, vEpoch, vEndMsg);
     }
 }
+
+Ltg::SignalHandle LuaDatasModel::luaModuleRegisterSignal(const std::string& vCategory, const std::string& vName) {
+    auto ptr = m_DatasModel.lock();
+    if (ptr != nullptr) {
+        return ptr->registerSignal(vCategory, vName);
+    }
+    return -1;
+}
+
+void LuaDatasModel::luaModuleAddValue(Ltg::SignalHandle vHandle, double vEpoch, double vValue) {
+    auto ptr = m_DatasModel.lock();
+    if (ptr != nullptr) {
+        ptr->addSignalValue(vHandle, vEpoch, vValue);
+    }
+}
+
+void LuaDatasModel::luaModuleAddValues(Ltg::SignalHandle vHandle, const sol::table& vEpochs, const sol::table& vValues) {
+    auto ptr = m_DatasModel.lock();
+    if (ptr != nullptr) {
+        const size_t count = std::min(vEpochs.size(), vValues.size());
+        m_Epochs.resize(count);
+        m_Values.resize(count);
+        for (size_t idx = 0U; idx < count; ++idx) {
+            m_Epochs[idx] = vEpochs.raw_get<double>(idx + 1U);
+            m_Values[idx] = vValues.raw_get<double>(idx + 1U);
+        }
+        ptr->addSignalValues(vHandle, m_Epochs.data(), m_Values.data(), count);
+    }
+}
@@ -4,15 +4,27 @@
 #include <sol/sol.hpp>
 
 #include <apis/LtgPluginApi.h>
+#include <apis/LtgEpochParser.h>
 #include <memory>
 #include <cstdint>
 #include <string>
+#include <vector>
 
 class LuaDatasModel;
 typedef std::shared_ptr<LuaDatasModel> LuaDatasModelPtr;
 typedef std::weak_ptr<LuaDatasModel> LuaDatasModelWeak;
 
 class LuaDatasModel {
+public:
+    // ticks buffer written by the scripts through the LuaJIT ffi, drained by flushTicks
+    // the layout is the ltg_tick_buffer struct declared in Module.cpp
+    struct TickBuffer {
+        int32_t count = 0;
+        int32_t capacity = 0;
+        Ltg::SignalValueTick* ticks = nullptr;
+    };
+    static constexpr int32_t sc_TICK_BUFFER_CAPACITY = 8192;
+
 public:
     static LuaDatasModelPtr create(Ltg::IDatasModelWeak vIDatasModel);
 
@@ -20,10 +32,18 @@ private:
     Ltg::IDatasModelWeak m_DatasModel;
     int32_t m_RowIndex = 0;
     int32_t m_RowCount = 0;
+    std::vector<double> m_Epochs;  // reused by luaModuleAddValues
+    std::vector<double> m_Values;  // reused by luaModuleAddValues
+    std::vector<Ltg::SignalValueTick> m_Ticks;
+    TickBuffer m_TickBuffer;
+    Ltg::EpochParser m_EpochParser;  // one per module instance, so per worker thread
 
 public:
     void setRowIndex(int32_t vRowIndex);
     void setRowCount(int32_t vRowCount);
+    TickBuffer* getTickBuffer();
+    // send the ticks of the buffer to the datas model
+    void flushTicks();
 
 public:
     double luaModuleGetRowIndex();
@@ -40,4 +60,7 @@ public:
     void luaModuleAddSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStatus);
     void luaModuleAddSignalStartZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStartMsg);
     void luaModuleAddSignalEndZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vEndMsg);
+    Ltg::SignalHandle luaModuleRegisterSignal(const std::string& vCategory, const std::string& vName);
+    void luaModuleAddValue(Ltg::SignalHandle vHandle, double vEpoch, double vValue);
+    void luaModuleAddValues(Ltg::SignalHandle vHandle, const sol::table& vEpochs, const sol::table& vValues);
 };
@@ -12,6 +12,39 @@
 #define SOL_ALL_SAFETIES_ON 1
 #include <sol/sol.hpp>
 
+// declare the ticks buffer to the script, usable through the LuaJIT ffi
+// without any call to the host until the buffer is full
+static constexpr const char* sc_FFI_TICK_BUFFER_PRELUDE = u8R"(
+local ffi = require("ffi")
+ffi.cdef[[
+typedef struct { int32_t handle; double epoch; double value; } ltg_tick;
+typedef struct { int32_t count; int32_t capacity; ltg_tick* ticks; } ltg_tick_buffer;
+]]
+ltg_ticks = ffi.cast("ltg_tick_buffer*", ltg_tick_buffer_ptr)
+function ltg_addTick(handle, epoch, value)
+    local buf = ltg_ticks
+    if buf.count >= buf.capacity then
+        ltg:flushTicks()
+    end
+    local tick = buf.ticks[buf.count]
+    tick.handle = handle
+    tick.epoch = epoch
+    tick.value = value
+    buf.count = buf.count + 1
+end
+)";
+
+struct LuaScriptFunctions {
+    sol::protected_function parse;
+    sol::protected_function parseBatch;  // optional
+};
+
+Module::Module() = default;
+
+Module::~Module() {
+    unload();
+}
+
 Ltg::ScriptingModulePtr Module::create(const SettingsWeak& vSettings) {
     assert(!vSettings.expired());
     auto res = std::make_shared<Module>();
@@ -69,6 +102,10 @@ bool Module::load(Ltg::IDatasModelWeak vDatasModel) {
                 &LuaDatasModel::luaModuleAddSignalValueWithDesc),
             "addSignalStartZone", &LuaDatasModel::luaModuleAddSignalStartZone,
             "addSignalEndZone", &LuaDatasModel::luaModuleAddSignalEndZone,
+            "registerSignal", &LuaDatasModel::luaModuleRegisterSignal,
+            "addValue", &LuaDatasModel::luaModuleAddValue,
+            "addValues", &LuaDatasModel::luaModuleAddValues,
+            "flushTicks", &LuaDatasModel::flushTicks,
             "logInfo", &LuaDatasModel::luaModuleLogInfo,
             "logWarning", &LuaDatasModel::luaModuleLogWarning,
             "logError", &LuaDatasModel::luaModuleLogError,
@@ -79,6 +116,14 @@ bool Module::load(Ltg::IDatasModelWeak vDatasModel) {
         // clang-format on
 
         (*m_luaPtr)["ltg"] = m_luaDatasModelPtr = LuaDatasModel::create(vDatasModel);
+        if (m_luaDatasModelPtr != nullptr) {
+            (*m_luaPtr)["ltg_tick_buffer_ptr"] = static_cast<void*>(m_luaDatasModelPtr->getTickBuffer());
+            auto result = m_luaPtr->safe_script(sc_FFI_TICK_BUFFER_PRELUDE, sol::script_pass_on_error);
+            if (!result.valid()) {
+                sol::error err = result;
+                LogVarLightWarning("Lua: the ffi ticks buffer is not available : %s", err.what());
+            }
+        }
 
         return (m_luaPtr != nullptr) && (m_luaDatasModelPtr != nullptr) && (!m_datasModel.expired());
     } catch (std::exception& ex) {
@@ -90,15 +135,19 @@ bool Module::load(Ltg::IDatasModelWeak vDatasModel) {
 }
 
 void Module::unload() {
+    m_luaFunctionsPtr.reset();  // the functions are refs in the lua state
     m_luaPtr.reset();
 }
 
 bool Module::compileScript(const Ltg::ScriptFilePathName& vFilePathName, Ltg::ErrorContainer& vOutErrors) {
     try {
         m_luaPtr->script_file(vFilePathName);
+        m_parallelSafe = (*m_luaPtr)["parallelSafe"].get_or(false);
         bool res = true;
-        sol::function parse = (*m_luaPtr)["parse"];
-        if (!parse.valid()) {
+        m_luaFunctionsPtr = std::make_unique<LuaScriptFunctions>();
+        m_luaFunctionsPtr->parse = (*m_luaPtr)["parse"];
+        m_luaFunctionsPtr->parseBatch = (*m_luaPtr)["parseBatch"];
+        if (!m_luaFunctionsPtr->parse.valid()) {
             LogVarLightError("Lua: %s", "the lua function parse(buffer) is missing");
             res = false;
         }
@@ -122,6 +171,7 @@ bool Module::callScriptStart(Ltg::ErrorContainer& vOutErrors) {
         return false;
     }
     sol::protected_function_result result = startFile();
+    m_flushTicks();
     if (!result.valid()) {
         sol::error err = result;
         LogVarLightError("Lua: error in startFile func call : %s", err.what());
@@ -131,12 +181,11 @@ bool Module::callScriptStart(Ltg::ErrorContainer& vOutErrors) {
 }
 
 bool Module::callScriptExec(const Ltg::ScriptingDatas& vOutDatas, Ltg::ErrorContainer& vErrors) {
-    sol::protected_function parse = (*m_luaPtr)["parse"];
-    if (!parse.valid()) {
+    if (m_luaFunctionsPtr == nullptr || !m_luaFunctionsPtr->parse.valid()) {
         LogVarLightError("Lua: %s", "the lua function parse(buffer) is missing");
         return false;
     }
-    sol::protected_function_result result = parse(vOutDatas.buffer);
+    sol::protected_function_result result = m_luaFunctionsPtr->parse(vOutDatas.buffer);
     if (!result.valid()) {
         sol::error err = result;
         LogVarLightError("Lua: error in parse func call : %s", err.what());
@@ -145,6 +194,27 @@ bool Module::callScriptExec(const Ltg::ScriptingDatas& vOutDatas, Ltg::ErrorCont
     return true;
 }
 
+bool Module::callScriptExecBatch(const Ltg::ScriptingDatasBatch& vDatas, Ltg::ErrorContainer& vErrors) {
+    if (m_luaFunctionsPtr == nullptr || !m_luaFunctionsPtr->parseBatch.valid()) {
+        // no parseBatch(lines) in the script, so call parse(buffer) for each line
+        return Ltg::ScriptingModule::callScriptExecBatch(vDatas, vErrors);
+    }
+    // getRowIndex() will return the row index of lines[1]
+    setRowIndex(vDatas.firstRowIndex);
+    auto lines = m_luaPtr->create_table(static_cast<int>(vDatas.count), 0);
+    for (size_t idx = 0U; idx < vDatas.count; ++idx) {
+        lines[idx + 1U] = vDatas.rows[idx];
+    }
+    sol::protected_function_result result = m_luaFunctionsPtr->parseBatch(lines);
+    m_flushTicks();
+    if (!result.valid()) {
+        sol::error err = result;
+        LogVarLightError("Lua: error in parseBatch func call : %s", err.what());
+        return false;
+    }
+    return true;
+}
+
 bool Module::callScriptEnd(Ltg::ErrorContainer& vOutErrors) {
     sol::protected_function endFile = (*m_luaPtr)["endFile"];
     if (!endFile.valid()) {
@@ -152,6 +222,7 @@ bool Module::callScriptEnd(Ltg::ErrorContainer& vOutErrors) {
         return false;
     }
     sol::protected_function_result result = endFile();
+    m_flushTicks();
     if (!result.valid()) {
         sol::error err = result;
         LogVarLightError("Lua: error in endFile func call : %s", err.what());
@@ -171,3 +242,13 @@ void Module::setRowCount(int32_t vRowCount) {
         m_luaDatasModelPtr->setRowCount(vRowCount);
     }
 }
+
+bool Module::isParallelSafe() const {
+    return m_parallelSafe;
+}
+
+void Module::m_flushTicks() {
+    if (m_luaDatasModelPtr != nullptr) {
+        m_luaDatasModelPtr->flushTicks();
+    }
+}
@@ -11,6 +11,8 @@ namespace sol {
 class state;
 }
 
+struct LuaScriptFunctions;
+
 //struct lua_State;
 class Module : public Ltg::ScriptingModule {
 public:
@@ -18,12 +20,15 @@ public:
 
 private:
     std::unique_ptr<sol::state> m_luaPtr = nullptr;
+    std::unique_ptr<LuaScriptFunctions> m_luaFunctionsPtr = nullptr;  // script functions fetched once after the compilation
     SettingsWeak m_settings;
     Ltg::IDatasModelWeak m_datasModel;
     LuaDatasModelPtr m_luaDatasModelPtr = nullptr;
+    bool m_parallelSafe = false;  // the script set the global parallelSafe to true
 
 public:
-    virtual ~Module() = default;
+    Module();
+    ~Module() override;
     bool init(Ltg::PluginBridge* vBridgePtr = nullptr) final;
     void unit() final;
 
@@ -32,8 +37,13 @@ public:
     bool compileScript(const Ltg::ScriptFilePathName& vFilePathName, Ltg::ErrorContainer& vOutErrors) final;
     bool callScriptStart(Ltg::ErrorContainer& vOutErrors) final;
     bool callScriptExec(const Ltg::ScriptingDatas& vOutDatas, Ltg::ErrorContainer& vErrors) final;
+    bool callScriptExecBatch(const Ltg::ScriptingDatasBatch& vDatas, Ltg::ErrorContainer& vErrors) final;
     bool callScriptEnd(Ltg::ErrorContainer& vOutErrors) final;
 
     void setRowIndex(int32_t vRowIndex) final;
     void setRowCount(int32_t vRowCount) final;
+    bool isParallelSafe() const final;
+
+private:
+    void m_flushTicks();
 };
@@ -241,7 +241,8 @@ void MainBackend::m_MainLoop() {
     while (!glfwWindowShouldClose(m_MainWindowPtr)) {
         {
 #ifndef _DEBUG
-            if (!ScriptingEngine::Instance()->IsJoinable()) {  // for not blocking threading progress bar animation
+            if (!ScriptingEngine::Instance()->IsJoinable() &&  // for not blocking threading progress bar animation
+                !ProjectFile::Instance()->IsLoading()) {
                 glfwWaitEventsTimeout(1.0);
             }
 #endif
@@ -272,6 +273,7 @@ void MainBackend::m_MainLoop() {
             MainFrontend::Instance()->Display(m_CurrentFrame, pos, size);
 
             ScriptingEngine::Instance()->FinishIfRequired();
+            ProjectFile::Instance()->FinishLoadIfRequired();
 
             ImGui::Render();
 
@@ -43,6 +43,8 @@ limitations under the License.
 #include <panes/GraphListPane.h>
 #include <panes/AnnotationPane.h>
 
+#include <models/log/LogEngine.h>
+
 #include <res/fontIcons.h>
 
 #include <systems/SettingsDialog.h>
@@ -279,18 +281,21 @@ void MainFrontend::OpenAboutDialog() {
 void MainFrontend::m_drawMainMenuBar() {
     if (ImGui::BeginMainMenuBar()) {
         if (ImGui::BeginMenu(ICON_FONT_ARCHIVE " Project")) {
-            if (ImGui::MenuItem(ICON_FONT_FILE " New")) {
+            // a project cant be opened or created while the current one is loading
+            const bool is_loading = ProjectFile::Instance()->IsLoading();
+
+            if (ImGui::MenuItem(ICON_FONT_FILE " New", nullptr, false, !is_loading)) {
                 Action_Menu_NewProject();
             }
 
-            if (ImGui::MenuItem(ICON_FONT_FOLDER_OPEN " Open")) {
+            if (ImGui::MenuItem(ICON_FONT_FOLDER_OPEN " Open", nullptr, false, !is_loading)) {
                 Action_Menu_OpenProject();
             }
 
             if (ProjectFile::Instance()->IsProjectLoaded()) {
                 ImGui::Separator();
 
-                if (ImGui::MenuItem(ICON_FONT_FOLDER_OPEN " Re Open")) {
+                if (ImGui::MenuItem(ICON_FONT_FOLDER_OPEN " Re Open", nullptr, false, !is_loading)) {
                     Action_Menu_ReOpenProject();
                 }
 
@@ -373,11 +378,28 @@ void MainFrontend::m_drawMainStatusBar() {
     if (ImGui::BeginMainStatusBar()) {
         Messaging::Instance()->DrawStatusBar();
 
+        // datas model memory
+        const auto& mem = LogEngine::Instance()->GetMemoryUsage();
+        const auto mem_total = mem.arena_reserved_bytes + mem.columns_bytes + mem.strings_bytes;
+        const auto mem_str = ez::str::toStr("Model : %.1f MB", static_cast<double>(mem_total) / (1024.0 * 1024.0));
+
         //  ImGui Infos
         const auto& io = ImGui::GetIO();
         const auto fps = ez::str::toStr("%.1f ms/frame (%.1f fps)", 1000.0f / io.Framerate, io.Framerate);
         const auto size = ImGui::CalcTextSize(fps.c_str());
-        ImGui::Spacing(ImGui::GetContentRegionAvail().x - size.x - ImGui::GetStyle().FramePadding.x * 2.0f);
+        const auto mem_size = ImGui::CalcTextSize(mem_str.c_str());
+        ImGui::Spacing(ImGui::GetContentRegionAvail().x - size.x - mem_size.x - ImGui::GetStyle().FramePadding.x * 4.0f);
+        ImGui::Text("%s", mem_str.c_str());
+        if (ImGui::IsItemHovered()) {
+            ImGui::SetTooltip("ticks : %u\narena : %.1f MB used / %.1f MB reserved (%u allocations)\ncolumns : %.1f MB\nstrings : %.1f MB",
+                              static_cast<uint32_t>(mem.ticks_count),
+                              static_cast<double>(mem.arena_used_bytes) / (1024.0 * 1024.0),
+                              static_cast<double>(mem.arena_reserved_bytes) / (1024.0 * 1024.0),
+                              static_cast<uint32_t>(mem.arena_allocations),
+                              static_cast<double>(mem.columns_bytes) / (1024.0 * 1024.0),
+                              static_cast<double>(mem.strings_bytes) / (1024.0 * 1024.0));
+        }
+        ImGui::SameLine();
         ImGui::Text("%s", fps.c_str());
 
         // MainFrontend::sAnyWindowsHovered |= ImGui::IsWindowHovered();
@@ -36,6 +36,7 @@ typedef double SignalValue;
 typedef std::string SignalString;
 typedef std::string SignalStatus;
 typedef std::string SignalDesc;
+typedef uint32_t SignalStringID;  // id of a string interned in the SignalStringPool
 
 typedef ez::dvec2 SignalValueRange;
 typedef const ez::dvec2& SignalValueRangeConstRef;
@@ -56,6 +57,8 @@ typedef std::string DBFile;
 typedef std::string SignalCategory;
 typedef int32_t SignalCategoryID;
 
+typedef int32_t SignalID;  // index of a serie in the LogEngine, given at ingestion
+
 typedef int32_t DBRowID;
 
 typedef std::string SignalDateTime;
@@ -73,6 +76,9 @@ typedef std::weak_ptr<SourceFile> SourceFileWeak;
 typedef std::map<SourceFileName, SourceFilePtr> SourceFilesContainer;
 typedef std::map<SourceFileName, SourceFilePtr>& SourceFilesContainerRef;
 
+class SignalArena;
+typedef std::shared_ptr<SignalArena> SignalArenaPtr;
+
 class SignalTick;
 typedef std::shared_ptr<SignalTick> SignalTickPtr;
 typedef std::weak_ptr<SignalTick> SignalTickWeak;
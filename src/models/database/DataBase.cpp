@@ -19,12 +19,23 @@ limitations under the License.
 
 #include "DataBase.h"
 
+#include <chrono>
 #include <vector>
 #include <sstream>
 #include <fstream>
 #include <string.h>
 #include <sqlite3.hpp>
 #include <ezlibs/ezFile.hpp>
+#include <models/log/SignalStringPool.h>
+
+// text of a column without copy, empty if null
+static std::string_view sGetColumnText(sqlite3_stmt* vStmt, const int vColumn) {
+    auto txt = (const char*)sqlite3_column_text(vStmt, vColumn);
+    if (txt == nullptr) {
+        return {};
+    }
+    return std::string_view(txt, (size_t)sqlite3_column_bytes(vStmt, vColumn));
+}
 
 // will check database header magic number
 // https://www.sqlite.org/fileformat.html : section 1.3
@@ -80,12 +91,15 @@ bool DataBase::BeginTransaction() {
     return false;
 }
 
-void DataBase::CommitTransaction() {
+bool DataBase::CommitTransaction() {
+    bool res = true;
     if (sqlite3_exec(m_SqliteDB, "COMMIT;", nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
         LogVarError("Fail to commit : %s", m_LastErrorMsg);
+        res = false;
     }
     // we will close the db so force it to reset
     m_TransactionStarted = false;
+    return res;
 }
 
 void DataBase::RollbackTransaction() {
@@ -153,105 +167,219 @@ std::string DataBase::GetSettingsXMLDatas() {
     return res;
 }
 
+bool DataBase::SetSnapshot(const uint32_t& vVersion, const std::vector<uint8_t>& vDatas) {
+    if (!CreateSnapshotTable()) {
+        return false;
+    }
+    if (sqlite3_exec(m_SqliteDB, "delete from signal_snapshot;", nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
+        LogVarError("Fail to clear the table signal_snapshot of database : %s", m_LastErrorMsg);
+        return false;
+    }
+    bool res = false;
+    auto insert_query = u8R"(insert into signal_snapshot (version, datas) values(?1, ?2);)";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(m_SqliteDB, insert_query, -1, &stmt, nullptr) != SQLITE_OK) {
+        LogVarError("Fail to insert the snapshot in database : %s", sqlite3_errmsg(m_SqliteDB));
+    } else {
+        sqlite3_bind_int(stmt, 1, (int32_t)vVersion);
+        sqlite3_bind_blob64(stmt, 2, vDatas.data(), (sqlite3_uint64)vDatas.size(), SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            LogVarError("Fail to insert the snapshot in database : %s", sqlite3_errmsg(m_SqliteDB));
+        } else {
+            res = true;
+        }
+    }
+
+    sqlite3_finalize(stmt);
+
+    return res;
+}
+
+bool DataBase::GetSnapshot(const uint32_t& vVersion, std::vector<uint8_t>& vOutDatas) {
+    bool res = false;
+    vOutDatas.clear();
+
+    // the table not exist in the projects of the previous versions, so no error
+    auto select_query = u8R"(select datas from signal_snapshot where version = ?1;)";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) == SQLITE_OK) {
+        sqlite3_bind_int(stmt, 1, (int32_t)vVersion);
+        if (sqlite3_step(stmt) == SQLITE_ROW) {
+            auto len = sqlite3_column_bytes(stmt, 0);
+            auto blob = (const uint8_t*)sqlite3_column_blob(stmt, 0);
+            if (blob && len) {
+                vOutDatas.assign(blob, blob + len);
+                res = true;
+            }
+        }
+    }
+
+    sqlite3_finalize(stmt);
+
+    return res;
+}
+
 DBRowID DataBase::AddSourceFile(const SourceFileName& vSourceFile) {
-    auto insert_query = ez::str::toStr(u8R"(insert or ignore into signal_sources (source) values("%s");)", vSourceFile.c_str());
-    if (sqlite3_exec(m_SqliteDB, insert_query.c_str(), nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
-        LogVarError("Fail to insert a source file in database : %s", m_LastErrorMsg);
-        return -1;
+    auto insert_query = u8R"(insert or ignore into signal_sources (source) values(?1);)";
+    sqlite3_stmt* stmt = nullptr;
+    DBRowID res = -1;
+    if (sqlite3_prepare_v2(m_SqliteDB, insert_query, -1, &stmt, nullptr) != SQLITE_OK) {
+        LogVarError("Fail to insert a source file in database : %s", sqlite3_errmsg(m_SqliteDB));
+    } else {
+        sqlite3_bind_text(stmt, 1, vSourceFile.c_str(), (int)vSourceFile.size(), SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            LogVarError("Fail to insert a source file in database : %s", sqlite3_errmsg(m_SqliteDB));
+        } else {
+            res = (DBRowID)sqlite3_last_insert_rowid(m_SqliteDB);
+        }
     }
-    return (DBRowID)sqlite3_last_insert_rowid(m_SqliteDB);
+    sqlite3_finalize(stmt);
+    return res;
 }
 
-void DataBase::AddSignalCategory(const SignalCategory& vSignalCategory) {
-    auto insert_query = ez::str::toStr(u8R"(insert or ignore into signal_categories (category) values("%s");)", vSignalCategory.c_str());
-    if (sqlite3_exec(m_SqliteDB, insert_query.c_str(), nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
-        LogVarError("Fail to insert a signal category in database : %s", m_LastErrorMsg);
+DBRowID DataBase::AddSignalCategory(const SignalCategory& vSignalCategory) {
+    const auto it = m_SignalCategoryIDs.find(vSignalCategory);
+    if (it != m_SignalCategoryIDs.end()) {
+        return it->second;
+    }
+    auto stmt = PrepareCachedStatement(m_InsertSignalCategoryStmt, u8R"(insert or ignore into signal_categories (category) values(?1);)");
+    if (stmt == nullptr) {
+        return -1;
     }
+    sqlite3_bind_text(stmt, 1, vSignalCategory.c_str(), (int)vSignalCategory.size(), SQLITE_STATIC);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        LogVarError("Fail to insert a signal category in database : %s", sqlite3_errmsg(m_SqliteDB));
+        return -1;
+    }
+    // already in database if ignored
+    const DBRowID res = (sqlite3_changes(m_SqliteDB) > 0) ? (DBRowID)sqlite3_last_insert_rowid(m_SqliteDB) : GetSignalCategory(vSignalCategory);
+    if (res > 0) {
+        m_SignalCategoryIDs[vSignalCategory] = res;
+    }
+    return res;
 }
 
-void DataBase::AddSignalName(const SignalName& vSignalName) {
-    auto insert_query = ez::str::toStr(u8R"(insert or ignore into signal_names (name) values("%s");)", vSignalName.c_str());
-    if (sqlite3_exec(m_SqliteDB, insert_query.c_str(), nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
-        LogVarError("Fail to insert a signal name in database : %s", m_LastErrorMsg);
+DBRowID DataBase::AddSignalName(const SignalName& vSignalName) {
+    const auto it = m_SignalNameIDs.find(vSignalName);
+    if (it != m_SignalNameIDs.end()) {
+        return it->second;
+    }
+    auto stmt = PrepareCachedStatement(m_InsertSignalNameStmt, u8R"(insert or ignore into signal_names (name) values(?1);)");
+    if (stmt == nullptr) {
+        return -1;
     }
+    sqlite3_bind_text(stmt, 1, vSignalName.c_str(), (int)vSignalName.size(), SQLITE_STATIC);
+    if (sqlite3_step(stmt) != SQLITE_DONE) {
+        LogVarError("Fail to insert a signal name in database : %s", sqlite3_errmsg(m_SqliteDB));
+        return -1;
+    }
+    // already in database if ignored
+    const DBRowID res = (sqlite3_changes(m_SqliteDB) > 0) ? (DBRowID)sqlite3_last_insert_rowid(m_SqliteDB) : GetSignalName(vSignalName);
+    if (res > 0) {
+        m_SignalNameIDs[vSignalName] = res;
+    }
+    return res;
 }
 
-void DataBase::AddSignalTick(const SourceFileID& vSourceFileID,
+bool DataBase::AddSignalTick(const SourceFileID& vSourceFileID,
                              const SignalCategory& vSignalCategory,
                              const SignalName& vSignalName,
                              const SignalEpochTime& vDate,
                              const SignalValue& vValue,
                              const SignalDesc& vDesc) {
-    AddSignalCategory(vSignalCategory);
-    AddSignalName(vSignalName);
-
-    auto insert_query = ez::str::toStr(
-        u8R"(insert or ignore into signal_ticks 
-(id_signal_source, id_signal_category, id_signal_name, epoch_time, signal_value, signal_desc) values(%i,
-(select rowid from signal_categories where signal_categories.category = "%s"),
-(select rowid from signal_names where signal_names.name = "%s"),
-%f,%f,"%s");)",
-        (int32_t)vSourceFileID,
-        vSignalCategory.c_str(),
-        vSignalName.c_str(),
-        vDate,
-        vValue,
-        vDesc.c_str());
-    if (sqlite3_exec(m_SqliteDB, insert_query.c_str(), nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
-        LogVarError("Fail to insert a tick in database : %s", m_LastErrorMsg);
-    }
-}
-
-void DataBase::AddSignalStatus(const SourceFileID& vSourceFileID,
+    return AddSignalTick(vSourceFileID, AddSignalCategory(vSignalCategory), AddSignalName(vSignalName), vDate, vValue, vDesc);
+}
+
+bool DataBase::AddSignalTick(const SourceFileID& vSourceFileID,
+                             const DBRowID& vSignalCategoryID,
+                             const DBRowID& vSignalNameID,
+                             const SignalEpochTime& vDate,
+                             const SignalValue& vValue,
+                             const SignalDesc& vDesc) {
+    auto stmt = PrepareCachedStatement(m_InsertSignalTickStmt,
+                                       u8R"(insert or ignore into signal_ticks 
+(id_signal_source, id_signal_category, id_signal_name, epoch_time, signal_value, signal_desc) values(?1,?2,?3,?4,?5,?6);)");
+    bool res = false;
+    if (stmt != nullptr) {
+        sqlite3_bind_int(stmt, 1, (int32_t)vSourceFileID);
+        sqlite3_bind_int(stmt, 2, (int32_t)vSignalCategoryID);
+        sqlite3_bind_int(stmt, 3, (int32_t)vSignalNameID);
+        sqlite3_bind_double(stmt, 4, vDate);
+        sqlite3_bind_double(stmt, 5, vValue);
+        sqlite3_bind_text(stmt, 6, vDesc.c_str(), (int)vDesc.size(), SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            LogVarError("Fail to insert a tick in database : %s", sqlite3_errmsg(m_SqliteDB));
+        } else {
+            res = true;
+        }
+    }
+    return res;
+}
+
+bool DataBase::AddSignalStatus(const SourceFileID& vSourceFileID,
                                const SignalCategory& vSignalCategory,
                                const SignalName& vSignalName,
                                const SignalEpochTime& vDate,
                                const SignalString& vString,
                                const SignalStatus& vStatus) {
-    AddSignalCategory(vSignalCategory);
-    AddSignalName(vSignalName);
-
-    auto insert_query = ez::str::toStr(
-        u8R"(insert or ignore into signal_ticks 
-(id_signal_source, id_signal_category, id_signal_name, epoch_time, signal_string, signal_status) values(%i,
-(select rowid from signal_categories where signal_categories.category = "%s"),
-(select rowid from signal_names where signal_names.name = "%s"),
-%f,"%s","%s");)",
-        (int32_t)vSourceFileID,
-        vSignalCategory.c_str(),
-        vSignalName.c_str(),
-        vDate,
-        vString.c_str(),
-        vStatus.c_str());
-    if (sqlite3_exec(m_SqliteDB, insert_query.c_str(), nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
-        LogVarError("Fail to insert a tick in database : %s", m_LastErrorMsg);
-    }
-}
-
-void DataBase::AddSignalTag(const SignalEpochTime& vDate, const SignalTagColor& vColor, const SignalTagName& vName, const SignalTagHelp& vHelp) {
-    auto insert_query = ez::str::toStr(
-        u8R"(insert or ignore into signal_tags 
-(epoch_time, tag_color, tag_name, tag_help) values (%f, "%u;%u;%u;%u", "%s", "%s");)",
-        vDate,
-        (uint32_t)vColor.x,
-        (uint32_t)vColor.y,
-        (uint32_t)vColor.z,
-        (uint32_t)vColor.w,
-        vName.c_str(),
-        vHelp.c_str());
-    if (sqlite3_exec(m_SqliteDB, insert_query.c_str(), nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
-        LogVarError("Fail to insert a tag in database : %s", m_LastErrorMsg);
+    return AddSignalStatus(vSourceFileID, AddSignalCategory(vSignalCategory), AddSignalName(vSignalName), vDate, vString, vStatus);
+}
+
+bool DataBase::AddSignalStatus(const SourceFileID& vSourceFileID,
+                               const DBRowID& vSignalCategoryID,
+                               const DBRowID& vSignalNameID,
+                               const SignalEpochTime& vDate,
+                               const SignalString& vString,
+                               const SignalStatus& vStatus) {
+    auto stmt = PrepareCachedStatement(m_InsertSignalStatusStmt,
+                                       u8R"(insert or ignore into signal_ticks 
+(id_signal_source, id_signal_category, id_signal_name, epoch_time, signal_string, signal_status) values(?1,?2,?3,?4,?5,?6);)");
+    bool res = false;
+    if (stmt != nullptr) {
+        sqlite3_bind_int(stmt, 1, (int32_t)vSourceFileID);
+        sqlite3_bind_int(stmt, 2, (int32_t)vSignalCategoryID);
+        sqlite3_bind_int(stmt, 3, (int32_t)vSignalNameID);
+        sqlite3_bind_double(stmt, 4, vDate);
+        sqlite3_bind_text(stmt, 5, vString.c_str(), (int)vString.size(), SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 6, vStatus.c_str(), (int)vStatus.size(), SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            LogVarError("Fail to insert a tick in database : %s", sqlite3_errmsg(m_SqliteDB));
+        } else {
+            res = true;
+        }
     }
+    return res;
+}
+
+bool DataBase::AddSignalTag(const SignalEpochTime& vDate, const SignalTagColor& vColor, const SignalTagName& vName, const SignalTagHelp& vHelp) {
+    auto stmt = PrepareCachedStatement(m_InsertSignalTagStmt,
+                                       u8R"(insert or ignore into signal_tags 
+(epoch_time, tag_color, tag_name, tag_help) values (?1,?2,?3,?4);)");
+    bool res = false;
+    if (stmt != nullptr) {
+        const auto tag_color = ez::str::toStr("%u;%u;%u;%u", (uint32_t)vColor.x, (uint32_t)vColor.y, (uint32_t)vColor.z, (uint32_t)vColor.w);
+        sqlite3_bind_double(stmt, 1, vDate);
+        sqlite3_bind_text(stmt, 2, tag_color.c_str(), (int)tag_color.size(), SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 3, vName.c_str(), (int)vName.size(), SQLITE_STATIC);
+        sqlite3_bind_text(stmt, 4, vHelp.c_str(), (int)vHelp.size(), SQLITE_STATIC);
+        if (sqlite3_step(stmt) != SQLITE_DONE) {
+            LogVarError("Fail to insert a tag in database : %s", sqlite3_errmsg(m_SqliteDB));
+        } else {
+            res = true;
+        }
+    }
+    return res;
 }
 
 DBRowID DataBase::GetSourceFile(const SourceFileName& vSourceFile) {
     DBRowID res = -1;
 
-    auto select_query = ez::str::toStr(u8R"(select rowid from signal_sources where signal_sources.source = "%s";)", vSourceFile.c_str());
+    auto select_query = u8R"(select rowid from signal_sources where signal_sources.source = ?1;)";
     sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(m_SqliteDB, select_query.c_str(), (int)select_query.size(), &stmt, nullptr) != SQLITE_OK) {
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) != SQLITE_OK) {
         LogVarError("%s", "Fail to get id from signal_sources in database");
     } else {
+        sqlite3_bind_text(stmt, 1, vSourceFile.c_str(), (int)vSourceFile.size(), SQLITE_STATIC);
         if (sqlite3_step(stmt) == SQLITE_ROW) {
             res = (DBRowID)sqlite3_column_int(stmt, 0);
         }
@@ -265,11 +393,12 @@ DBRowID DataBase::GetSourceFile(const SourceFileName& vSourceFile) {
 DBRowID DataBase::GetSignalCategory(const SignalCategory& vSignalCategory) {
     DBRowID res = -1;
 
-    auto select_query = ez::str::toStr(u8R"(select rowid from signal_categories where signal_categories.category = "%s";)", vSignalCategory.c_str());
+    auto select_query = u8R"(select rowid from signal_categories where signal_categories.category = ?1;)";
     sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(m_SqliteDB, select_query.c_str(), (int)select_query.size(), &stmt, nullptr) != SQLITE_OK) {
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) != SQLITE_OK) {
         LogVarError("%s", "Fail to get id from signal_categories in database");
     } else {
+        sqlite3_bind_text(stmt, 1, vSignalCategory.c_str(), (int)vSignalCategory.size(), SQLITE_STATIC);
         if (sqlite3_step(stmt) == SQLITE_ROW) {
             res = (DBRowID)sqlite3_column_int(stmt, 0);
         }
@@ -283,11 +412,12 @@ DBRowID DataBase::GetSignalCategory(const SignalCategory& vSignalCategory) {
 DBRowID DataBase::GetSignalName(const SignalName& vSignalName) {
     DBRowID res = -1;
 
-    auto select_query = ez::str::toStr(u8R"(select rowid from signal_names where signal_names.name = "%s";)", vSignalName.c_str());
+    auto select_query = u8R"(select rowid from signal_names where signal_names.name = ?1;)";
     sqlite3_stmt* stmt = nullptr;
-    if (sqlite3_prepare_v2(m_SqliteDB, select_query.c_str(), (int)select_query.size(), &stmt, nullptr) != SQLITE_OK) {
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) != SQLITE_OK) {
         LogVarError("%s", "Fail to get id from signal_names in database");
     } else {
+        sqlite3_bind_text(stmt, 1, vSignalName.c_str(), (int)vSignalName.size(), SQLITE_STATIC);
         if (sqlite3_step(stmt) == SQLITE_ROW) {
             res = (DBRowID)sqlite3_column_int(stmt, 0);
         }
@@ -299,6 +429,7 @@ DBRowID DataBase::GetSignalName(const SignalName& vSignalName) {
 }
 
 void DataBase::ClearDataTables() {
+    CreateSnapshotTable();
     auto clear_query =
         u8R"(
 begin transaction;
@@ -307,11 +438,62 @@ delete from signal_categories;
 delete from signal_names;
 delete from signal_ticks;
 delete from signal_tags;
+delete from signal_snapshot;
 commit;
 )";
     if (sqlite3_exec(m_SqliteDB, clear_query, nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
         LogVarError("Fail to clear datas tables in database : %s", m_LastErrorMsg);
     }
+    // the cached rowids are no more valid
+    m_SignalCategoryIDs.clear();
+    m_SignalNameIDs.clear();
+}
+
+void DataBase::BeginIngestionProfile() {
+    // the rollback journal stay on disk (truncated and not deleted on commit), so a crash of the app
+    // during a transaction is rolled back and the project settings, annotations and snapshot are kept
+    // with synchronous off, a crash of the os or a power loss during the parse can still corrupt the file
+    auto profile_query =
+        u8R"(
+pragma journal_mode = truncate;
+pragma synchronous = off;
+pragma temp_store = memory;
+pragma cache_size = -262144;
+drop index if exists signal_ticks_time;
+drop index if exists signal_ticks_name_time;
+)";
+    if (sqlite3_exec(m_SqliteDB, profile_query, nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
+        LogVarError("Fail to set the ingestion profile of database : %s", m_LastErrorMsg);
+    }
+}
+
+void DataBase::EndIngestionProfile() {
+    const auto start_time = std::chrono::steady_clock::now();
+    auto index_query =
+        u8R"(
+create index if not exists signal_ticks_time on signal_ticks (epoch_time);
+create index if not exists signal_ticks_name_time on signal_ticks (id_signal_name, epoch_time);
+pragma synchronous = full;
+pragma journal_mode = delete;
+)";
+    if (sqlite3_exec(m_SqliteDB, index_query, nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
+        LogVarError("Fail to create the ticks indexes of database : %s", m_LastErrorMsg);
+    } else {
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        LogVarInfo("Ticks indexes created in %.3f s", elapsed);
+    }
+}
+
+void DataBase::SetReadProfile() {
+    auto profile_query =
+        u8R"(
+pragma mmap_size = 1073741824;
+pragma temp_store = memory;
+pragma cache_size = -65536;
+)";
+    if (sqlite3_exec(m_SqliteDB, profile_query, nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
+        LogVarError("Fail to set the read profile of database : %s", m_LastErrorMsg);
+    }
 }
 
 void DataBase::GetSourceFiles(std::function<void(const SourceFileID&, const SourceFilePathName&)> vCallback) {
@@ -441,6 +623,140 @@ order by
     sqlite3_finalize(stmt);
 }
 
+void DataBase::GetSignalCategories(std::function<void(const DBRowID&, const SignalCategory&)> vCallback) {
+    // no interest to call that without a callback for retrieve datas
+    assert(vCallback);
+
+    auto select_query = u8R"(select rowid, category from signal_categories;)";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) != SQLITE_OK) {
+        LogVarError("%s", "Fail to get signal_categories from database");
+    } else {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            auto category_cstr = (const char*)sqlite3_column_text(stmt, 1);  // can be null
+            vCallback((DBRowID)sqlite3_column_int(stmt, 0), (category_cstr != nullptr) ? category_cstr : "");
+        }
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+void DataBase::GetSignalNames(std::function<void(const DBRowID&, const SignalName&)> vCallback) {
+    // no interest to call that without a callback for retrieve datas
+    assert(vCallback);
+
+    auto select_query = u8R"(select rowid, name from signal_names;)";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) != SQLITE_OK) {
+        LogVarError("%s", "Fail to get signal_names from database");
+    } else {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            auto name_cstr = (const char*)sqlite3_column_text(stmt, 1);  // can be null
+            vCallback((DBRowID)sqlite3_column_int(stmt, 0), (name_cstr != nullptr) ? name_cstr : "");
+        }
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+void DataBase::GetSignals(std::function<void(const SourceFileID&, const DBRowID&, const DBRowID&, const bool, const size_t&)> vCallback) {
+    // no interest to call that without a callback for retrieve datas
+    assert(vCallback);
+
+    // with min(), sqlite take the other columns from the row of the min
+    auto select_query =
+        u8R"(
+SELECT
+  id_signal_source,
+  id_signal_category,
+  id_signal_name,
+  ifnull(signal_string, '') <> '',
+  min(epoch_time),
+  count(*)
+FROM
+ signal_ticks
+GROUP BY
+ id_signal_category,
+ id_signal_name
+;
+)";
+    sqlite3_stmt* stmt = nullptr;
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &stmt, nullptr) != SQLITE_OK) {
+        LogVarError("%s", "Fail to get the signals from database");
+    } else {
+        while (sqlite3_step(stmt) == SQLITE_ROW) {
+            vCallback((SourceFileID)sqlite3_column_int(stmt, 0),
+                      (DBRowID)sqlite3_column_int(stmt, 1),
+                      (DBRowID)sqlite3_column_int(stmt, 2),
+                      (sqlite3_column_int(stmt, 3) != 0),
+                      (size_t)sqlite3_column_int64(stmt, 5));
+        }
+    }
+
+    sqlite3_finalize(stmt);
+}
+
+bool DataBase::OpenTicksCursor(SignalStringPool& vStringPool) {
+    CloseTicksCursor();
+
+    auto select_query =
+        u8R"(
+SELECT
+  id_signal_source,
+  epoch_time,
+  id_signal_category,
+  id_signal_name,
+  signal_value,
+  signal_string,
+  signal_status,
+  signal_desc
+FROM
+ signal_ticks
+ORDER BY
+ epoch_time
+;
+)";
+    if (sqlite3_prepare_v2(m_SqliteDB, select_query, -1, &m_TicksCursorStmt, nullptr) != SQLITE_OK) {
+        LogVarError("%s", "Fail to get signal_ticks from database");
+        CloseTicksCursor();
+        return false;
+    }
+    m_TicksCursorStringPoolPtr = &vStringPool;
+    m_TicksCursorDone = false;
+    return true;
+}
+
+bool DataBase::ReadTicksBatch(DataBaseTicksBatch& vOutBatch, const size_t& vMaxRowsCount) {
+    vOutBatch.clear();
+    if (m_TicksCursorStmt == nullptr || m_TicksCursorStringPoolPtr == nullptr) {
+        return false;
+    }
+    auto& pool = *m_TicksCursorStringPoolPtr;
+    // a step after the last row would restart the query
+    while (!m_TicksCursorDone && vOutBatch.size() < vMaxRowsCount) {
+        if (sqlite3_step(m_TicksCursorStmt) != SQLITE_ROW) {
+            m_TicksCursorDone = true;
+            break;
+        }
+        vOutBatch.source_ids.push_back((SourceFileID)sqlite3_column_int(m_TicksCursorStmt, 0));
+        vOutBatch.epoch_times.push_back(sqlite3_column_double(m_TicksCursorStmt, 1));
+        vOutBatch.category_ids.push_back((DBRowID)sqlite3_column_int(m_TicksCursorStmt, 2));
+        vOutBatch.name_ids.push_back((DBRowID)sqlite3_column_int(m_TicksCursorStmt, 3));
+        vOutBatch.values.push_back(sqlite3_column_double(m_TicksCursorStmt, 4));
+        vOutBatch.string_ids.push_back(pool.intern(sGetColumnText(m_TicksCursorStmt, 5)));
+        vOutBatch.status_ids.push_back(pool.intern(sGetColumnText(m_TicksCursorStmt, 6)));
+        vOutBatch.desc_ids.push_back(pool.intern(sGetColumnText(m_TicksCursorStmt, 7)));
+    }
+    return vOutBatch.size() > 0U;
+}
+
+void DataBase::CloseTicksCursor() {
+    sqlite3_finalize(m_TicksCursorStmt);  // harmless on nullptr
+    m_TicksCursorStmt = nullptr;
+    m_TicksCursorStringPoolPtr = nullptr;
+    m_TicksCursorDone = false;
+}
+
 void DataBase::GetTags(std::function<void(const SignalEpochTime&, const SignalTagColor&, const SignalTagName&, const SignalTagHelp&)> vCallback) {
     // no interest to call that without a callback for retrieve datas
     assert(vCallback);
@@ -530,6 +846,15 @@ bool DataBase::CreateDB() {
     return (m_SqliteDB != nullptr);
 }
 
+bool DataBase::CreateSnapshotTable() {
+    auto create_query = u8R"(create table if not exists signal_snapshot (version INTEGER, datas BLOB);)";
+    if (sqlite3_exec(m_SqliteDB, create_query, nullptr, nullptr, &m_LastErrorMsg) != SQLITE_OK) {
+        LogVarError("Fail to create the table signal_snapshot of database : %s", m_LastErrorMsg);
+        return false;
+    }
+    return true;
+}
+
 void DataBase::CreateDBTables() {
     if (m_SqliteDB)  // in the doubt
     {
@@ -584,6 +909,9 @@ create table app_settings (
 }
 
 void DataBase::CloseDB() {
+    // unfinalized statements would make the close busy
+    FinalizeCachedStatements();
+
     if (m_SqliteDB) {
         if (sqlite3_close(m_SqliteDB) == SQLITE_BUSY) {
             // try to force closing
@@ -594,4 +922,32 @@ void DataBase::CloseDB() {
     m_SqliteDB = nullptr;
 
     // there is also sqlite3LeaveMutexAndCloseZombie when sqlite is stucked
-}
\ No newline at end of file
+}
+
+sqlite3_stmt* DataBase::PrepareCachedStatement(sqlite3_stmt*& vStmt, const char* vQuery) {
+    if (vStmt == nullptr) {
+        if (sqlite3_prepare_v2(m_SqliteDB, vQuery, -1, &vStmt, nullptr) != SQLITE_OK) {
+            LogVarError("Fail to prepare statement : %s", sqlite3_errmsg(m_SqliteDB));
+            sqlite3_finalize(vStmt);
+            vStmt = nullptr;
+        }
+    } else {
+        sqlite3_reset(vStmt);
+        sqlite3_clear_bindings(vStmt);
+    }
+    return vStmt;
+}
+
+void DataBase::FinalizeCachedStatements() {
+    CloseTicksCursor();
+    for (auto* stmt_ptr : {&m_InsertSignalCategoryStmt,  //
+                           &m_InsertSignalNameStmt,
+                           &m_InsertSignalTickStmt,
+                           &m_InsertSignalStatusStmt,
+                           &m_InsertSignalTagStmt}) {
+        sqlite3_finalize(*stmt_ptr);  // harmless on nullptr
+        *stmt_ptr = nullptr;
+    }
+    m_SignalCategoryIDs.clear();
+    m_SignalNameIDs.clear();
+}
@@ -18,17 +18,67 @@ limitations under the License.
 
 #include <memory>
 #include <string>
+#include <vector>
+#include <cstdint>
 #include <functional>
+#include <unordered_map>
 #include <headers/DatasDef.h>
 
 struct sqlite3;
+struct sqlite3_stmt;
+class SignalStringPool;
+
+// a batch of rows of the ticks cursor, in columns
+// the texts are given by their id in the SignalStringPool of the cursor, an empty or null text is the empty id
+struct DataBaseTicksBatch {
+    std::vector<SourceFileID> source_ids;
+    std::vector<SignalEpochTime> epoch_times;
+    std::vector<DBRowID> category_ids;
+    std::vector<DBRowID> name_ids;
+    std::vector<SignalValue> values;
+    std::vector<SignalStringID> string_ids;
+    std::vector<SignalStringID> status_ids;
+    std::vector<SignalStringID> desc_ids;
+
+    size_t size() const { return epoch_times.size(); }
+    void clear() {  // keep the capacity, so a batch is allocated once
+        source_ids.clear();
+        epoch_times.clear();
+        category_ids.clear();
+        name_ids.clear();
+        values.clear();
+        string_ids.clear();
+        status_ids.clear();
+        desc_ids.clear();
+    }
+};
+
 class DataBase {
+public:
+    static constexpr size_t sc_TICKS_BATCH_SIZE = 4096U;
+
 private:
     sqlite3* m_SqliteDB = nullptr;
     std::string m_DataBaseFilePathName = "datas.db3";
     bool m_TransactionStarted = false;
     char* m_LastErrorMsg = nullptr;
 
+    // statements prepared once per connection and reused for each insert
+    sqlite3_stmt* m_InsertSignalCategoryStmt = nullptr;
+    sqlite3_stmt* m_InsertSignalNameStmt = nullptr;
+    sqlite3_stmt* m_InsertSignalTickStmt = nullptr;
+    sqlite3_stmt* m_InsertSignalStatusStmt = nullptr;
+    sqlite3_stmt* m_InsertSignalTagStmt = nullptr;
+
+    // ticks cursor
+    sqlite3_stmt* m_TicksCursorStmt = nullptr;
+    SignalStringPool* m_TicksCursorStringPoolPtr = nullptr;
+    bool m_TicksCursorDone = false;
+
+    // rowid cache of categories and names, valid for the current connection
+    std::unordered_map<SignalCategory, DBRowID> m_SignalCategoryIDs;
+    std::unordered_map<SignalName, DBRowID> m_SignalNameIDs;
+
 public:
     /// <summary>
     /// check if the file is a valid Sqlite3 DB
@@ -65,7 +115,8 @@ public:
     /// <summary>
     /// will commit the transaction mode
     /// </summary>
-    void CommitTransaction();
+    /// <returns>true is sucessfully commited</returns>
+    bool CommitTransaction();
 
     /// <summary>
     /// will cancel the transaction mode
@@ -83,13 +134,15 @@ public:
     /// Add a signal category in database
     /// </summary>
     /// <param name="vSignalCategory"></param>
-    void AddSignalCategory(const SignalCategory& vSignalCategory);
+    /// <returns>return the id of the entry, or -1</returns>
+    DBRowID AddSignalCategory(const SignalCategory& vSignalCategory);
 
     /// <summary>
     /// Add a signal name in database
     /// </summary>
     /// <param name="vSignalName"></param>
-    void AddSignalName(const SignalName& vSignalName);
+    /// <returns>return the id of the entry, or -1</returns>
+    DBRowID AddSignalName(const SignalName& vSignalName);
 
     /// <summary>
     /// add a signal tick in database
@@ -101,7 +154,8 @@ public:
     /// <param name="vDate"></param>
     /// <param name="vValue"></param>>
     /// <param name="vDesc">description of the value. displayed only when mouse hover a graph</param>
-    void AddSignalTick(const SourceFileID& vSourceFileID,
+    /// <returns>true if the tick is inserted</returns>
+    bool AddSignalTick(const SourceFileID& vSourceFileID,
                        const SignalCategory& vSignalCategory,
                        const SignalName& vSignalName,
                        const SignalEpochTime& vDate,
@@ -117,13 +171,48 @@ public:
     /// <param name="vName"></param>
     /// <param name="vDate"></param>
     /// <param name="vValue"></param>
-    void AddSignalStatus(const SourceFileID& vSourceFileID,
+    /// <returns>true if the status is inserted</returns>
+    bool AddSignalStatus(const SourceFileID& vSourceFileID,
                          const SignalCategory& vSignalCategory,
                          const SignalName& vSignalName,
                          const SignalEpochTime& vDate,
                          const SignalString& vString,
                          const SignalStatus& vStatus);
 
+    /// <summary>
+    /// add a signal tick in database with already known category and name ids
+    /// </summary>
+    /// <param name="vSourceFileID"></param>
+    /// <param name="vSignalCategoryID">id returned by AddSignalCategory</param>
+    /// <param name="vSignalNameID">id returned by AddSignalName</param>
+    /// <param name="vDate"></param>
+    /// <param name="vValue"></param>
+    /// <param name="vDesc">description of the value. displayed only when mouse hover a graph</param>
+    /// <returns>true if the tick is inserted</returns>
+    bool AddSignalTick(const SourceFileID& vSourceFileID,
+                       const DBRowID& vSignalCategoryID,
+                       const DBRowID& vSignalNameID,
+                       const SignalEpochTime& vDate,
+                       const SignalValue& vValue,
+                       const SignalDesc& vDesc);
+
+    /// <summary>
+    /// add a signal Status in database with already known category and name ids
+    /// </summary>
+    /// <param name="vSourceFileID"></param>
+    /// <param name="vSignalCategoryID">id returned by AddSignalCategory</param>
+    /// <param name="vSignalNameID">id returned by AddSignalName</param>
+    /// <param name="vDate"></param>
+    /// <param name="vString"></param>
+    /// <param name="vStatus"></param>
+    /// <returns>true if the status is inserted</returns>
+    bool AddSignalStatus(const SourceFileID& vSourceFileID,
+                         const DBRowID& vSignalCategoryID,
+                         const DBRowID& vSignalNameID,
+                         const SignalEpochTime& vDate,
+                         const SignalString& vString,
+                         const SignalStatus& vStatus);
+
     /// <summary>
     /// add a signal tag in database
     /// </summary>
@@ -131,7 +220,8 @@ public:
     /// <param name="vColor"></param>
     /// <param name="vName"></param>
     /// <param name="vHelp"></param>
-    void AddSignalTag(const SignalEpochTime& vDate, const SignalTagColor& vColor, const SignalTagName& vName, const SignalTagHelp& vHelp);
+    /// <returns>true if the tag is inserted</returns>
+    bool AddSignalTag(const SignalEpochTime& vDate, const SignalTagColor& vColor, const SignalTagName& vName, const SignalTagHelp& vHelp);
 
     /// <summary>
     /// Get the id of a source file from database
@@ -159,6 +249,22 @@ public:
     /// </summary>
     void ClearDataTables();
 
+    /// <summary>
+    /// profile for the bulk insert of the ticks : relaxed journal and synchronous, big cache
+    /// the ticks indexes are dropped, they will be created by EndIngestionProfile
+    /// </summary>
+    void BeginIngestionProfile();
+
+    /// <summary>
+    /// will create the ticks indexes and restore the default journal and synchronous
+    /// </summary>
+    void EndIngestionProfile();
+
+    /// <summary>
+    /// profile for the read of the project : memory mapped file and big cache
+    /// </summary>
+    void SetReadProfile();
+
     /// <summary>
     /// willreturn soruce files infos
     /// <param name="vCallback">callback func called for each database line retrieved</param>
@@ -180,6 +286,46 @@ public:
                                      const SignalDesc&)>
             vCallback);
 
+    /// <summary>
+    /// will return the categories with their rowid
+    /// <param name="vCallback">callback func called for each database line retrieved</param>
+    /// </summary>
+    void GetSignalCategories(std::function<void(const DBRowID&, const SignalCategory&)> vCallback);
+
+    /// <summary>
+    /// will return the names with their rowid
+    /// <param name="vCallback">callback func called for each database line retrieved</param>
+    /// </summary>
+    void GetSignalNames(std::function<void(const DBRowID&, const SignalName&)> vCallback);
+
+    /// <summary>
+    /// will return the catalogue of the signals, without reading their ticks
+    /// the source and the kind (value or status) are the ones of the first tick of the signal
+    /// <param name="vCallback">callback func called for each signal (source, category rowid, name rowid, is status, ticks count)</param>
+    /// </summary>
+    void GetSignals(std::function<void(const SourceFileID&, const DBRowID&, const DBRowID&, const bool, const size_t&)> vCallback);
+
+    /// <summary>
+    /// will open a cursor on the ticks sorted by time, to read by batchs with ReadTicksBatch
+    /// no join, the source, the category and the name are given by their rowid
+    /// </summary>
+    /// <param name="vStringPool">the texts are interned in it, must live until CloseTicksCursor</param>
+    /// <returns>true, if the cursor is opened</returns>
+    bool OpenTicksCursor(SignalStringPool& vStringPool);
+
+    /// <summary>
+    /// will read the next rows of the ticks cursor, no allocation if the batch have the capacity
+    /// </summary>
+    /// <param name="vOutBatch">cleared, then filled with the rows</param>
+    /// <param name="vMaxRowsCount">max count of rows of the batch</param>
+    /// <returns>false, if there is no more rows</returns>
+    bool ReadTicksBatch(DataBaseTicksBatch& vOutBatch, const size_t& vMaxRowsCount = sc_TICKS_BATCH_SIZE);
+
+    /// <summary>
+    /// will close the ticks cursor
+    /// </summary>
+    void CloseTicksCursor();
+
     /// <summary>
     /// will return tags in callbakk
     /// <param name="vCallback">callback func called for each database line retrieved</param>
@@ -205,12 +351,47 @@ public:
     /// <returns>settings xml datas</returns>
     std::string GetSettingsXMLDatas();
 
+    /// <summary>
+    /// will put the snapshot of the finalized datas in db, replace the previous one
+    /// </summary>
+    /// <param name="vVersion">version of the snapshot format</param>
+    /// <param name="vDatas">the binary snapshot</param>
+    /// <returns>true, is successfully saved</returns>
+    bool SetSnapshot(const uint32_t& vVersion, const std::vector<uint8_t>& vDatas);
+
+    /// <summary>
+    /// will get from db the snapshot of the finalized datas
+    /// </summary>
+    /// <param name="vVersion">version of the snapshot format</param>
+    /// <param name="vOutDatas">the binary snapshot</param>
+    /// <returns>false if there is no snapshot of this version</returns>
+    bool GetSnapshot(const uint32_t& vVersion, std::vector<uint8_t>& vOutDatas);
+
 private:
     bool OpenDB();
     void CloseDB();
     bool CreateDB();
     void CreateDBTables();
 
+    /// <summary>
+    /// create the snapshot table if not exist, the projects of the previous versions dont have it
+    /// </summary>
+    bool CreateSnapshotTable();
+
+    /// <summary>
+    /// prepare the statement if not already done for the current connection
+    /// </summary>
+    /// <param name="vStmt">the cached statement</param>
+    /// <param name="vQuery"></param>
+    /// <returns>the statement reset and ready to bind, or nullptr</returns>
+    sqlite3_stmt* PrepareCachedStatement(sqlite3_stmt*& vStmt, const char* vQuery);
+
+    /// <summary>
+    /// finalize the cached statements and clear the rowid caches
+    /// must be done before closing the connection
+    /// </summary>
+    void FinalizeCachedStatements();
+
     /// <summary>
     /// enable foreign key (must be done at each connections)
     /// </summary>
@@ -0,0 +1,194 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "DataBaseWriter.h"
+#include "DataBase.h"
+
+void DataBaseWriter::Start() {
+    Stop();
+    {
+        std::lock_guard<std::mutex> guard(m_SignalsMutex);
+        m_SignalHandles.clear();
+        m_Signals.clear();
+    }
+    m_SignalRowIDs.clear();
+    m_WrittenRecordsCount = 0U;
+    m_LostRecordsCount = 0U;
+    m_Running = true;
+    m_WriterThread = std::thread(&DataBaseWriter::m_run, this);
+}
+
+void DataBaseWriter::Stop() {
+    {
+        std::lock_guard<std::mutex> guard(m_QueueMutex);
+        m_Running = false;
+    }
+    m_QueueNotEmpty.notify_all();
+    if (m_WriterThread.joinable()) {
+        m_WriterThread.join();
+    }
+}
+
+SignalHandle DataBaseWriter::RegisterSignal(const SignalCategory& vCategory, const SignalName& vName) {
+    std::lock_guard<std::mutex> guard(m_SignalsMutex);
+    auto key = std::make_pair(vCategory, vName);
+    const auto it = m_SignalHandles.find(key);
+    if (it != m_SignalHandles.end()) {
+        return it->second;
+    }
+    const auto handle = static_cast<SignalHandle>(m_Signals.size());
+    m_Signals.push_back(key);
+    m_SignalHandles[std::move(key)] = handle;
+    return handle;
+}
+
+void DataBaseWriter::PushBatch(DataBaseRecords& vRecords) {
+    if (vRecords.empty()) {
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(m_QueueMutex);
+        // back-pressure : the producer wait for the writer
+        m_QueueNotFull.wait(lock, [this]() { return m_Queue.size() < sc_MAX_QUEUED_BATCHES || !m_Running; });
+        if (!m_Running) {
+            LogVarError("%s", "the database writer is not running, records are lost");
+            m_LostRecordsCount += vRecords.size();
+            vRecords.clear();
+            return;
+        }
+        m_Queue.push_back(std::move(vRecords));
+    }
+    m_QueueNotEmpty.notify_one();
+    vRecords = DataBaseRecords();
+    vRecords.reserve(sc_BATCH_SIZE);
+}
+
+size_t DataBaseWriter::GetWrittenRecordsCount() const {
+    return m_WrittenRecordsCount;
+}
+
+size_t DataBaseWriter::GetLostRecordsCount() const {
+    return m_LostRecordsCount;
+}
+
+void DataBaseWriter::m_run() {
+    std::deque<DataBaseRecords> batchs;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_QueueMutex);
+            m_QueueNotEmpty.wait(lock, [this]() { return !m_Queue.empty() || !m_Running; });
+            if (m_Queue.empty() && !m_Running) {
+                break;
+            }
+            batchs.swap(m_Queue);
+        }
+        m_QueueNotFull.notify_all();
+        if (DataBase::Instance()->BeginTransaction()) {
+            size_t written_records_count = 0U;
+            for (const auto& batch : batchs) {
+                written_records_count += m_writeRecords(batch);
+            }
+            if (DataBase::Instance()->CommitTransaction()) {
+                m_WrittenRecordsCount += written_records_count;
+            } else {
+                // nothing of the group reached the file
+                m_LostRecordsCount += written_records_count;
+                LogVarError("the database transaction cant be commited, %u batchs (%u records) are lost",
+                            static_cast<uint32_t>(batchs.size()),
+                            static_cast<uint32_t>(written_records_count));
+            }
+        } else {
+            size_t lost_records_count = 0U;
+            for (const auto& batch : batchs) {
+                lost_records_count += batch.size();
+            }
+            m_LostRecordsCount += lost_records_count;
+            LogVarError("the database transaction cant be started, %u batchs (%u records) are lost",
+                        static_cast<uint32_t>(batchs.size()),
+                        static_cast<uint32_t>(lost_records_count));
+        }
+        batchs.clear();
+    }
+}
+
+// return the count of records inserted in the current transaction
+size_t DataBaseWriter::m_writeRecords(const DataBaseRecords& vRecords) {
+    auto db_ptr = DataBase::Instance();
+    DBRowID category_id = -1;
+    DBRowID name_id = -1;
+    size_t written_records_count = 0U;
+    size_t unresolved_records_count = 0U;
+    for (const auto& record : vRecords) {
+        bool inserted = false;
+        switch (record.type) {
+            case DataBaseRecordType::TICK: {
+                if (m_getSignalRowIDs(record.handle, category_id, name_id)) {
+                    inserted = db_ptr->AddSignalTick(record.source_file_id, category_id, name_id, record.epoch, record.value, record.text);
+                } else {
+                    ++unresolved_records_count;
+                }
+            } break;
+            case DataBaseRecordType::STATUS: {
+                if (m_getSignalRowIDs(record.handle, category_id, name_id)) {
+                    inserted = db_ptr->AddSignalStatus(record.source_file_id, category_id, name_id, record.epoch, record.text, record.status);
+                } else {
+                    ++unresolved_records_count;
+                }
+            } break;
+            case DataBaseRecordType::TAG: {
+                inserted = db_ptr->AddSignalTag(record.epoch, record.color, record.text, record.status);
+            } break;
+        }
+        if (inserted) {
+            ++written_records_count;
+        }
+    }
+    if (unresolved_records_count > 0U) {
+        LogVarError("%u records have an unknown signal handle and are lost", static_cast<uint32_t>(unresolved_records_count));
+    }
+    // the failed inserts are already logged by the DataBase
+    m_LostRecordsCount += vRecords.size() - written_records_count;
+    return written_records_count;
+}
+
+bool DataBaseWriter::m_getSignalRowIDs(const SignalHandle& vHandle, DBRowID& vOutCategoryID, DBRowID& vOutNameID) {
+    if (vHandle < 0) {
+        return false;
+    }
+    const auto idx = static_cast<size_t>(vHandle);
+    if (idx >= m_SignalRowIDs.size()) {
+        // new handles, resolve them in database
+        std::vector<std::pair<SignalCategory, SignalName>> signals;
+        {
+            std::lock_guard<std::mutex> guard(m_SignalsMutex);
+            if (idx >= m_Signals.size()) {
+                return false;
+            }
+            signals.assign(m_Signals.begin() + m_SignalRowIDs.size(), m_Signals.end());
+        }
+        auto db_ptr = DataBase::Instance();
+        for (const auto& signal : signals) {
+            m_SignalRowIDs.emplace_back(db_ptr->AddSignalCategory(signal.first), db_ptr->AddSignalName(signal.second));
+        }
+    }
+    const auto& ids = m_SignalRowIDs.at(idx);
+    vOutCategoryID = ids.first;
+    vOutNameID = ids.second;
+    return true;
+}
@@ -0,0 +1,111 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <map>
+#include <deque>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <string>
+#include <vector>
+#include <utility>
+#include <condition_variable>
+#include <headers/DatasDef.h>
+
+typedef int32_t SignalHandle;
+
+enum class DataBaseRecordType : uint8_t { TICK = 0, STATUS, TAG };
+
+// one row to write in database
+// the signal category and name are interned in a SignalHandle
+struct DataBaseRecord {
+    DataBaseRecordType type = DataBaseRecordType::TICK;
+    SignalHandle handle = -1;         // not used for tags
+    SourceFileID source_file_id = 0;  // not used for tags
+    SignalEpochTime epoch = 0.0;
+    SignalValue value = 0.0;          // TICK
+    std::string text;                 // TICK : desc, STATUS : string, TAG : name
+    std::string status;               // STATUS : status, TAG : help
+    SignalTagColor color;             // TAG
+};
+typedef std::vector<DataBaseRecord> DataBaseRecords;
+
+// consumer of the records produced by the scripting
+// the records are pushed by batchs in a bounded queue
+// and written in database by a dedicated thread, one transaction per drained group
+// so the parsing and the database writing can overlap
+// the records are committed as they come, so when a script fail on a file,
+// the records produced before the error are kept (no rollback of the file like before)
+class DataBaseWriter {
+public:
+    static constexpr size_t sc_BATCH_SIZE = 4096U;          // records count of a producer batch
+    static constexpr size_t sc_MAX_QUEUED_BATCHES = 64U;    // producers will wait if more batchs are queued
+
+private:
+    std::thread m_WriterThread;
+    std::mutex m_QueueMutex;
+    std::condition_variable m_QueueNotEmpty;
+    std::condition_variable m_QueueNotFull;
+    std::deque<DataBaseRecords> m_Queue;
+    bool m_Running = false;
+    std::atomic<size_t> m_WrittenRecordsCount{0U};
+    std::atomic<size_t> m_LostRecordsCount{0U};  // records not inserted, not resolved or not commited
+
+    // signal handles registry, shared by producers
+    mutable std::mutex m_SignalsMutex;
+    std::map<std::pair<SignalCategory, SignalName>, SignalHandle> m_SignalHandles;
+    std::vector<std::pair<SignalCategory, SignalName>> m_Signals;
+
+    // database ids of each handle, only used by the writer thread
+    std::vector<std::pair<DBRowID, DBRowID>> m_SignalRowIDs;
+
+public:
+    // start the writer thread, the database must be opened
+    void Start();
+
+    // write the remaining batchs and stop the writer thread
+    void Stop();
+
+    // return the handle of the signal, registered at the first call
+    SignalHandle RegisterSignal(const SignalCategory& vCategory, const SignalName& vName);
+
+    // move the records in the queue, wait if the queue is full
+    // vRecords is cleared and can be reused by the producer
+    void PushBatch(DataBaseRecords& vRecords);
+
+    size_t GetWrittenRecordsCount() const;
+    size_t GetLostRecordsCount() const;
+
+private:
+    void m_run();
+    size_t m_writeRecords(const DataBaseRecords& vRecords);
+    bool m_getSignalRowIDs(const SignalHandle& vHandle, DBRowID& vOutCategoryID, DBRowID& vOutNameID);
+
+public:  // singleton
+    static std::shared_ptr<DataBaseWriter> Instance() {
+        static std::shared_ptr<DataBaseWriter> _instance = std::make_shared<DataBaseWriter>();
+        return _instance;
+    }
+
+public:
+    DataBaseWriter() = default;                                          // Prevent construction
+    DataBaseWriter(const DataBaseWriter&) = delete;                      // Prevent construction by copying
+    DataBaseWriter& operator=(const DataBaseWriter&) { return *this; };  // Prevent assignment
+    virtual ~DataBaseWriter() { Stop(); }                                // Prevent unwanted destruction
+};
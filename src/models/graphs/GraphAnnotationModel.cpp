@@ -51,3 +51,7 @@ void GraphAnnotationModel::erase(GraphAnnotationPtr vGraphAnnotationPtr) {
 size_t GraphAnnotationModel::size() {
     return m_GraphAnnotationModel.size();
 }
+
+void GraphAnnotationModel::Clear() {
+    m_GraphAnnotationModel.clear();
+}
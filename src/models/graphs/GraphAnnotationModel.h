@@ -34,6 +34,7 @@ public:
     GraphAnnotationPtr& at(const size_t& vIdx);
     void erase(GraphAnnotationPtr vGraphAnnotationPtr);
     size_t size();
+    void Clear();
 
 public:  // singleton
     static std::shared_ptr<GraphAnnotationModel> Instance() {
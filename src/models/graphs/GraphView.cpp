@@ -35,6 +35,9 @@ limitations under the License.
 
 #include <ezlibs/ezTools.hpp>
 
+#include <cmath>
+#include <algorithm>
+
 #define DRAG_LINE_LOG_HOVERED_TIME 0
 #define DRAG_LINE_FIRST_DIFF_MARK 1
 #define DRAG_LINE_SECOND_DIFF_MARK 2
@@ -51,6 +54,8 @@ void GraphView::Clear() {
     m_GraphGroups.push_back(GraphGroup::Create());  // first group : default group
     m_GraphGroups.push_back(GraphGroup::Create());  // last group
     m_Range_Value = SignalValueRange(0.5, -0.5) * DBL_MAX;
+    m_CurveCaches.clear();
+    m_CurrentAnnotationPtr = nullptr;
 }
 
 void GraphView::AddSerieToGroup(const SignalSerieWeak& vSignalSerie, const GraphGroupPtr& vToGroupPtr) {
@@ -223,7 +228,7 @@ void GraphView::DrawGraphGroupTable() {
                             if (ImGui::Selectable(datas_ptr->name.c_str(), false, ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowItemOverlap)) {
                                 datas_ptr->show = !datas_ptr->show;
 
-                                LogEngine::Instance()->ShowHideSignal(datas_ptr->category, datas_ptr->name, datas_ptr->show);
+                                LogEngine::Instance()->ShowHideSignal(datas_ptr->id, datas_ptr->show);
 
                                 if (ProjectFile::Instance()->m_CollapseLogSelection) {
                                     LogPane::Instance()->PrepareLog();
@@ -366,9 +371,9 @@ void GraphView::prEraseGroupAt(const size_t& vIdx) {
     }
 }
 
-bool GraphView::prBeginPlot(const std::string& vLabel, ez::dvec2 vRangeValue, const ImVec2& vSize, const bool vFirstGraph) const {
+bool GraphView::prBeginPlot(const char* vLabel, ez::dvec2 vRangeValue, const ImVec2& vSize, const bool vFirstGraph) const {
     const auto& time_range = LogEngine::Instance()->GetTicksTimeSerieRange();
-    if (ImPlot::BeginPlot(vLabel.c_str(), vSize, ImPlotFlags_NoChild | ImPlotFlags_NoTitle)) {
+    if (ImPlot::BeginPlot(vLabel, vSize, ImPlotFlags_NoChild | ImPlotFlags_NoTitle)) {
         if (m_need_show_hide_x_axis) {
             ImPlotPlot& plot = *GImPlot->CurrentPlot;
             ImPlotAxis& axis = plot.Axes[ImAxis_X1];
@@ -522,6 +527,188 @@ void GraphView::prEndPlot(const bool vFirstGraph) {
     ImPlot::EndPlot();
 }
 
+void GraphView::prDrawSignalCurve(ImDrawList* vDrawListPtr, const SignalSeriePtr& vSeriePtr, const ImU32& vColor, const float& vThickness) {
+    const auto& ticks_time = vSeriePtr->ticks_time;
+    if (vDrawListPtr == nullptr || ticks_time.empty()) {
+        return;
+    }
+
+    // the bounds of the serie, in place of a fit by tick
+    ImPlot::FitPoint(ImPlotPoint(ticks_time.front(), vSeriePtr->range_value.x));
+    ImPlot::FitPoint(ImPlotPoint(ticks_time.back(), vSeriePtr->range_value.y));
+
+    // the segments are projected again only if the view or the serie was changed
+    auto& cache = m_CurveCaches[vSeriePtr->id];
+    const auto& plot_limits = ImPlot::GetPlotLimits();
+    const auto& plot_pos = ImPlot::GetPlotPos();
+    const auto& plot_size = ImPlot::GetPlotSize();
+    if (cache.serie_version != vSeriePtr->version ||                                                   //
+        cache.plot_limits.X.Min != plot_limits.X.Min || cache.plot_limits.X.Max != plot_limits.X.Max ||  //
+        cache.plot_limits.Y.Min != plot_limits.Y.Min || cache.plot_limits.Y.Max != plot_limits.Y.Max ||  //
+        cache.plot_pos.x != plot_pos.x || cache.plot_pos.y != plot_pos.y ||                              //
+        cache.plot_size.x != plot_size.x || cache.plot_size.y != plot_size.y) {
+        cache.serie_version = vSeriePtr->version;
+        cache.plot_limits = plot_limits;
+        cache.plot_pos = plot_pos;
+        cache.plot_size = plot_size;
+        prProjectSignalCurve(vSeriePtr, cache.segments);
+    }
+
+    for (size_t idx = 0U; idx + 1U < cache.segments.size(); idx += 2U) {
+        vDrawListPtr->AddLine(cache.segments[idx], cache.segments[idx + 1U], vColor, vThickness);
+    }
+}
+
+// the step from the previous point to a tick
+static void sProjectTickStep(const ImVec2& vPos, ImVec2& vInOutLastPos, std::vector<ImVec2>& vOutSegments) {
+    vOutSegments.push_back(vInOutLastPos);
+    vOutSegments.push_back(ImVec2(vPos.x, vInOutLastPos.y));
+    vOutSegments.push_back(ImVec2(vPos.x, vInOutLastPos.y));
+    vOutSegments.push_back(vPos);
+    vInOutLastPos = vPos;
+}
+
+// a bucket not wider than a pixel is a vertical line from its min to its max, for keep the peaks,
+// then the step from its last value to the next bucket
+// a wider bucket (bursty ticks) is drawn by its sub buckets, until the ticks, so it has no gap
+static void sProjectLodBucket(const SignalSerie& vSerie,
+                              const size_t& vLevelIdx,
+                              const size_t& vBucketIdx,
+                              ImVec2& vInOutLastPos,
+                              std::vector<ImVec2>& vOutSegments) {
+    const auto& bucket = vSerie.lod_levels[vLevelIdx][vBucketIdx];
+    const auto min_pos = ImPlot::PlotToPixels(bucket.time_first, bucket.value_min);
+    const auto last_pos = ImPlot::PlotToPixels(bucket.time_last, bucket.value_last);
+    if (last_pos.x - min_pos.x > 1.0f) {
+        const auto first_sub_idx = vBucketIdx * SignalSerie::sc_LOD_FACTOR;
+        if (vLevelIdx == 0U) {
+            const auto end_sub_idx = ez::mini(first_sub_idx + SignalSerie::sc_LOD_FACTOR, vSerie.ticks_time.size());
+            for (size_t idx = first_sub_idx; idx < end_sub_idx; ++idx) {
+                sProjectTickStep(ImPlot::PlotToPixels(vSerie.ticks_time[idx], vSerie.ticks_value[idx]), vInOutLastPos, vOutSegments);
+            }
+        } else {
+            const auto end_sub_idx = ez::mini(first_sub_idx + SignalSerie::sc_LOD_FACTOR, vSerie.lod_levels[vLevelIdx - 1U].size());
+            for (size_t idx = first_sub_idx; idx < end_sub_idx; ++idx) {
+                sProjectLodBucket(vSerie, vLevelIdx - 1U, idx, vInOutLastPos, vOutSegments);
+            }
+        }
+        return;
+    }
+    const auto max_y = ImPlot::PlotToPixels(bucket.time_first, bucket.value_max).y;
+    vOutSegments.push_back(vInOutLastPos);
+    vOutSegments.push_back(ImVec2(min_pos.x, vInOutLastPos.y));
+    vOutSegments.push_back(ImVec2(min_pos.x, ez::mini(ez::mini(max_y, min_pos.y), vInOutLastPos.y)));
+    vOutSegments.push_back(ImVec2(min_pos.x, ez::maxi(ez::maxi(max_y, min_pos.y), vInOutLastPos.y)));
+    vInOutLastPos = last_pos;
+}
+
+void GraphView::prProjectSignalCurve(const SignalSeriePtr& vSeriePtr, std::vector<ImVec2>& vOutSegments) {
+    vOutSegments.clear();  // the capacity is kept, so no allocation when the view change a bit
+    const auto& ticks_time = vSeriePtr->ticks_time;
+    const auto& ticks_value = vSeriePtr->ticks_value;
+
+    // only the ticks in the time limits of the plot
+    const auto& plot_limits = ImPlot::GetPlotLimits();
+    size_t first_idx = 0U;
+    size_t end_idx = 0U;
+    vSeriePtr->getVisibleTicksRange(plot_limits.X.Min, plot_limits.X.Max, first_idx, end_idx);
+    if (first_idx >= end_idx) {
+        return;
+    }
+
+    // ticks count by pixel in the plot, for select the lod level
+    double ticks_per_pixel = 0.0;
+    const auto plot_width = static_cast<double>(ImPlot::GetPlotSize().x);
+    if (plot_width > 0.0) {
+        ticks_per_pixel = static_cast<double>(end_idx - first_idx) / plot_width;
+    }
+
+    const auto* level_ptr = vSeriePtr->getLodLevel(ticks_per_pixel);
+    if (level_ptr == nullptr) {
+        auto last_pos = ImPlot::PlotToPixels(ticks_time[first_idx], ticks_value[first_idx]);
+        for (size_t idx = first_idx + 1U; idx < end_idx; ++idx) {
+            sProjectTickStep(ImPlot::PlotToPixels(ticks_time[idx], ticks_value[idx]), last_pos, vOutSegments);
+        }
+    } else {
+        const auto& level = *level_ptr;
+        const auto level_idx = static_cast<size_t>(level_ptr - vSeriePtr->lod_levels.data());
+        SignalSerie::getVisibleBucketsRange(level, plot_limits.X.Min, plot_limits.X.Max, first_idx, end_idx);
+        if (first_idx >= end_idx) {
+            return;
+        }
+        auto last_pos = ImPlot::PlotToPixels(level[first_idx].time_first, level[first_idx].value_first);
+        for (size_t idx = first_idx; idx < end_idx; ++idx) {
+            sProjectLodBucket(*vSeriePtr, level_idx, idx, last_pos, vOutSegments);
+        }
+    }
+}
+
+void GraphView::prDrawSignalZones(ImDrawList* vDrawListPtr,
+                                  const SignalSeriePtr& vSeriePtr,
+                                  const double& vBottom,
+                                  const double& vTop,
+                                  const ImU32& vColor,
+                                  const bool vOutlined) {
+    const auto& zones = vSeriePtr->zones;
+    if (vDrawListPtr == nullptr || zones.empty()) {
+        return;
+    }
+
+    // the bounds of the zones, in place of a fit by zone
+    ImPlot::FitPoint(ImPlotPoint(zones.front().time_start, vBottom));
+    ImPlot::FitPoint(ImPlotPoint(zones.back().time_end, vTop));
+
+    const auto& plot_limits = ImPlot::GetPlotLimits();
+    const auto bottom_y = ImPlot::PlotToPixels(0.0, vBottom).y;
+    const auto top_y = ImPlot::PlotToPixels(0.0, vTop).y;
+    const auto outline_color = ImGui::GetColorU32(ImVec4(0, 0, 0, 1));
+    const auto color_v4 = ImGui::ColorConvertU32ToFloat4(vColor);
+
+    // the zones are sorted and not overlapping, so the first visible zone is the first ending after the plot start
+    const auto first_it = std::lower_bound(zones.begin(), zones.end(), plot_limits.X.Min, [](const SignalZone& vZone, const SignalEpochTime& vValue) {
+        return vZone.time_end < vValue;
+    });
+    auto idx = static_cast<size_t>(first_it - zones.begin());
+    while (idx < zones.size() && zones[idx].time_start <= plot_limits.X.Max) {
+        const auto& zone = zones[idx];
+        const auto start_x = ImPlot::PlotToPixels(zone.time_start, vBottom).x;
+        const auto end_x = ImPlot::PlotToPixels(zone.time_end, vBottom).x;
+        if (end_x - start_x >= 1.0f) {
+            vDrawListPtr->AddRectFilled(ImVec2(start_x, bottom_y), ImVec2(end_x, top_y), vColor);
+            if (vOutlined) {
+                vDrawListPtr->AddRect(ImVec2(start_x, bottom_y), ImVec2(end_x, top_y), outline_color);
+            }
+            ++idx;
+            continue;
+        }
+
+        // zones narrower than a pixel : one density bar for all the zones starting in the pixel column
+        // the covered time is given by the durations sums, so the cost is a binary search by column
+        const auto column_x = std::floor(start_x);
+        const auto column_start_time = ImPlot::PixelsToPlot(column_x, bottom_y).x;
+        const auto column_end_time = ImPlot::PixelsToPlot(column_x + 1.0f, bottom_y).x;
+        const auto end_it = std::lower_bound(zones.begin() + idx + 1U, zones.end(), column_end_time, [](const SignalZone& vZone, const SignalEpochTime& vValue) {
+            return vZone.time_start < vValue;
+        });
+        auto end_idx = static_cast<size_t>(end_it - zones.begin());
+        // only the last zone of the column can be wide, this one is drawn alone
+        if (end_idx - idx > 1U) {
+            const auto& last_zone = zones[end_idx - 1U];
+            if (ImPlot::PlotToPixels(last_zone.time_end, vBottom).x - ImPlot::PlotToPixels(last_zone.time_start, vBottom).x >= 1.0f) {
+                --end_idx;
+            }
+        }
+        const auto& last_zone = zones[end_idx - 1U];
+        const auto covered_time = last_zone.duration_before + (last_zone.time_end - last_zone.time_start) - zone.duration_before;
+        const auto column_time = column_end_time - column_start_time;
+        const auto density = (column_time > 0.0) ? ez::clamp(covered_time / column_time, 0.0, 1.0) : 1.0;
+        auto bar_color_v4 = color_v4;
+        bar_color_v4.w *= static_cast<float>(0.25 + 0.75 * density);  // a lone zone must stay visible
+        vDrawListPtr->AddRectFilled(ImVec2(column_x, bottom_y), ImVec2(column_x + 1.0f, top_y), ImGui::GetColorU32(bar_color_v4));
+        idx = end_idx;
+    }
+}
+
 void GraphView::prDrawSignalGraph_ImPlot(const SignalSerieWeak& vSignalSerie, const ImVec2& vSize, const bool vFirstGraph) {
     auto datas_ptr = vSignalSerie.lock();
     if (datas_ptr && datas_ptr->show_hide_temporary) {
@@ -551,167 +738,184 @@ void GraphView::prDrawSignalGraph_ImPlot(const SignalSerieWeak& vSignalSerie, co
         std::string _human_readbale_elapsed_time;
         SignalSeriePtr _current_hovered_serie = nullptr;
 
-        const auto& name_str = datas_ptr->category + " / " + datas_ptr->name;
-        if (prBeginPlot(name_str, datas_ptr->range_value, vSize, vFirstGraph)) {
+        const auto& name_str = datas_ptr->graph_label;
+        if (prBeginPlot(name_str.c_str(), datas_ptr->range_value, vSize, vFirstGraph)) {
             if (ImPlot::BeginItem(name_str.c_str())) {
                 const float thickness = (float)(datas_ptr->hovered_by_mouse ? _SelectedCurveDisplayThickNess : _DefaultCurveDisplayThickNess);
 
                 ImPlot::GetCurrentItem()->Color = datas_ptr->color_u32;
 
                 // render data
-                const auto& _data_values = datas_ptr->datas_values;
-                if (!_data_values.empty()) {
-                    // float zero_y = (float)ImPlot::PlotToPixels(0.0, 0.0).y;
-                    auto _data_ptr_0 = _data_values.at(0U).lock();
-                    if (_data_ptr_0) {
-                        double last_time = _data_ptr_0->time_epoch, current_time;
-                        double last_value = _data_ptr_0->value, current_value;
-                        std::string last_string = _data_ptr_0->string, current_string;
-                        std::string last_status = _data_ptr_0->status, current_status;
-                        std::string last_desc = _data_ptr_0->desc, current_desc;
-
-                        ImPlotPoint last_point = ImPlotPoint(last_time, _data_ptr_0->value);
-                        last_value_pos = ImPlot::PlotToPixels(last_point);
-
-                        for (size_t i = 1U; i < _data_values.size(); ++i) {
-                            auto _data_ptr_i = _data_values.at(i).lock();
-                            if (_data_ptr_i) {
-                                current_time = _data_ptr_i->time_epoch;
-                                current_value = _data_ptr_i->value;
-                                current_string = _data_ptr_i->string;
-                                current_status = _data_ptr_i->status;
-                                current_desc = _data_ptr_i->desc;
-                                if (i == 1U && !current_desc.empty() && last_desc.empty()) {
-                                    last_desc = current_desc;
-                                }
+                const auto& ticks_time = datas_ptr->ticks_time;
+                if (!ticks_time.empty()) {
+                    // the curve or the zones of the serie are drawn at once, so the loop visit only the hovered segment
+                    size_t hovered_idx = SignalSerie::sc_NO_TICK;
+                    if (datas_ptr->is_zone) {
+                        prDrawSignalZones(draw_list, datas_ptr, -1.0, 1.0, datas_ptr->color_u32, false);
+                        if (ImPlot::IsPlotHovered()) {
+                            const auto zone_idx = datas_ptr->findZoneIndexAt(hovered_time);
+                            if (zone_idx != SignalSerie::sc_NO_TICK) {
+                                hovered_idx = datas_ptr->zones[zone_idx].tick_idx;
+                            }
+                        }
+                    } else {
+                        prDrawSignalCurve(draw_list, datas_ptr, datas_ptr->color_u32, thickness);
+                        if (ImPlot::IsPlotHovered()) {
+                            hovered_idx = datas_ptr->findTickIndexAt(hovered_time, datas_ptr->hover_cursor);
+                        }
+                    }
+                    size_t first_idx = ticks_time.size();
+                    size_t end_idx = ticks_time.size();
+                    if (hovered_idx != SignalSerie::sc_NO_TICK) {
+                        first_idx = hovered_idx + 1U;
+                        end_idx = hovered_idx + 2U;
+                    }
 
-                                ImPlotPoint current_point = ImPlotPoint(current_time, current_value);
+                    // current annotation creation
+                    if (m_CurrentAnnotationPtr) {
+                        m_CurrentAnnotationPtr->DrawToPoint(datas_ptr, ImGui::GetMousePos());
+                    }
 
-                                value_pos = ImPlot::PlotToPixels(current_point);
+                    // float zero_y = (float)ImPlot::PlotToPixels(0.0, 0.0).y;
+                    double last_time = ticks_time[first_idx - 1U], current_time;
+                    double last_value = datas_ptr->ticks_value[first_idx - 1U], current_value;
+                    SignalStringID last_string_id = datas_ptr->ticks_string_id[first_idx - 1U], current_string_id;
+                    SignalStringID last_status_id = datas_ptr->ticks_status_id[first_idx - 1U], current_status_id;
+                    SignalStringID last_desc_id = datas_ptr->ticks_desc_id[first_idx - 1U], current_desc_id;
+
+                    ImPlotPoint last_point = ImPlotPoint(last_time, last_value);
+                    last_value_pos = ImPlot::PlotToPixels(last_point);
+
+                    for (size_t i = first_idx; i < end_idx; ++i) {
+                        current_time = ticks_time[i];
+                        current_value = datas_ptr->ticks_value[i];
+                        current_string_id = datas_ptr->ticks_string_id[i];
+                        current_status_id = datas_ptr->ticks_status_id[i];
+                        current_desc_id = datas_ptr->ticks_desc_id[i];
+                        if (i == 1U && current_desc_id != SignalStringPool::sc_EMPTY_ID && last_desc_id == SignalStringPool::sc_EMPTY_ID) {
+                            last_desc_id = current_desc_id;
+                        }
 
-                                const bool _is_hovered = (ImPlot::IsPlotHovered() && hovered_time >= last_time && hovered_time <= current_time);
-                                const ImU32& _color = _is_hovered ? _GraphMouseHoveredTimeColor : datas_ptr->color_u32;
+                        ImPlotPoint current_point = ImPlotPoint(current_time, current_value);
 
-                                if (last_string.empty()) {
-                                    ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
-                                    draw_list->AddLine(last_value_pos, ImVec2(value_pos.x, last_value_pos.y), _color, thickness);
-                                    draw_list->AddLine(ImVec2(value_pos.x, last_value_pos.y), value_pos, _color, thickness);
-                                } else {
-                                    if (last_status == LogEngine::sc_START_ZONE && current_status == LogEngine::sc_END_ZONE) {
-                                        ImPlot::FitPoint(ImPlotPoint(current_time, -1.0f));
-                                        ImPlot::FitPoint(ImPlotPoint(current_time, 1.0f));
-                                        ImVec2 last_pos = ImPlot::PlotToPixels(last_time, -1.0f);
-                                        ImVec2 cur_pos = ImPlot::PlotToPixels(current_time, 1.0f);
-                                        draw_list->AddRectFilled(last_pos, cur_pos, _color);
-                                        if (_is_hovered) {
-                                            draw_list->AddRect(last_pos, cur_pos, ImGui::GetColorU32(ImVec4(0, 0, 0, 1)), 0.0f, 0, (float)_SelectedCurveDisplayThickNess);
-                                        }
-                                    }
-                                }
+                        value_pos = ImPlot::PlotToPixels(current_point);
 
-                                // current annotation creation
-                                if (m_CurrentAnnotationPtr) {
-                                    m_CurrentAnnotationPtr->DrawToPoint(datas_ptr, ImGui::GetMousePos());
-                                }
+                        const bool _is_hovered = (ImPlot::IsPlotHovered() && hovered_time >= last_time && hovered_time <= current_time);
+                        const ImU32& _color = _is_hovered ? _GraphMouseHoveredTimeColor : datas_ptr->color_u32;
 
+                        if (last_string_id == SignalStringPool::sc_EMPTY_ID) {
+                            ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
+                            draw_list->AddLine(last_value_pos, ImVec2(value_pos.x, last_value_pos.y), _color, thickness);
+                            draw_list->AddLine(ImVec2(value_pos.x, last_value_pos.y), value_pos, _color, thickness);
+                        } else {
+                            if (last_status_id == SignalStringPool::sc_START_ZONE_ID && current_status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                ImPlot::FitPoint(ImPlotPoint(current_time, -1.0f));
+                                ImPlot::FitPoint(ImPlotPoint(current_time, 1.0f));
+                                ImVec2 last_pos = ImPlot::PlotToPixels(last_time, -1.0f);
+                                ImVec2 cur_pos = ImPlot::PlotToPixels(current_time, 1.0f);
+                                draw_list->AddRectFilled(last_pos, cur_pos, _color);
                                 if (_is_hovered) {
-                                    // for avoid frame time regeneration of this slow operation
-                                    // GraphAnnotation::sGetHumanReadableElapsedTime
-                                    if (_current_hovered_serie != datas_ptr) {
-                                        _human_readbale_elapsed_time = GraphAnnotation::sGetHumanReadableElapsedTime(current_time - last_time);
-                                    }
-                                    _current_hovered_serie = datas_ptr;
-
-                                    // mouse hover curve
-                                    const auto mouse_pos = ImGui::GetMousePos();
-                                    const auto last_pos = ImVec2(value_pos.x, last_value_pos.y);
-                                    datas_ptr->hovered_by_mouse =
-                                        GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_value_pos, last_pos, projected_point);
-                                    if (!datas_ptr->hovered_by_mouse) {
-                                        datas_ptr->hovered_by_mouse =
-                                            GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_pos, value_pos, projected_point);
-                                    }
+                                    draw_list->AddRect(last_pos, cur_pos, ImGui::GetColorU32(ImVec4(0, 0, 0, 1)), 0.0f, 0, (float)_SelectedCurveDisplayThickNess);
+                                }
+                            }
+                        }
 
-                                    // annotation start and end points
-                                    if (ImGui::IsMouseReleased(ImGuiMouseButton_Middle) && datas_ptr->hovered_by_mouse) {
-                                        if (m_CurrentAnnotationPtr) {
-                                            if (m_CurrentAnnotationPtr->GetParentSignalSerie().lock() == datas_ptr) {
-                                                m_CurrentAnnotationPtr->SetEndPoint(ImPlot::PixelsToPlot(projected_point));
-                                                m_CurrentAnnotationPtr = nullptr;  // remove the "draw to mouse point" of the current annotation
-                                            }
-                                        } else {
-                                            m_CurrentAnnotationPtr = GraphAnnotationModel::Instance()->NewGraphAnnotation(ImPlot::PixelsToPlot(projected_point));
-                                            m_CurrentAnnotationPtr->SetSignalSerieParent(datas_ptr);
-                                            datas_ptr->addGraphAnnotation(m_CurrentAnnotationPtr);
-                                        }
-                                    }
+                        if (_is_hovered) {
+                            // for avoid frame time regeneration of this slow operation
+                            // GraphAnnotation::sGetHumanReadableElapsedTime
+                            if (_current_hovered_serie != datas_ptr) {
+                                _human_readbale_elapsed_time = GraphAnnotation::sGetHumanReadableElapsedTime(current_time - last_time);
+                            }
+                            _current_hovered_serie = datas_ptr;
+
+                            // mouse hover curve
+                            const auto mouse_pos = ImGui::GetMousePos();
+                            const auto last_pos = ImVec2(value_pos.x, last_value_pos.y);
+                            datas_ptr->hovered_by_mouse =
+                                GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_value_pos, last_pos, projected_point);
+                            if (!datas_ptr->hovered_by_mouse) {
+                                datas_ptr->hovered_by_mouse =
+                                    GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_pos, value_pos, projected_point);
+                            }
 
-                                    // draw vertical cursor
-                                    auto pos = ImPlot::PlotToPixels(hovered_time, last_value);
-                                    if (!_already_drawn) {
-                                        draw_list->AddLine(pos - ImVec2(20.0f, 0.0f), pos + ImVec2(20.0f, 0.0f), _GraphMouseHoveredTimeColor, 1.0f);
-                                        _already_drawn = true;
+                            // annotation start and end points
+                            if (ImGui::IsMouseReleased(ImGuiMouseButton_Middle) && datas_ptr->hovered_by_mouse) {
+                                if (m_CurrentAnnotationPtr) {
+                                    if (m_CurrentAnnotationPtr->GetParentSignalSerie().lock() == datas_ptr) {
+                                        m_CurrentAnnotationPtr->SetEndPoint(ImPlot::PixelsToPlot(projected_point));
+                                        m_CurrentAnnotationPtr = nullptr;  // remove the "draw to mouse point" of the current annotation
                                     }
+                                } else {
+                                    m_CurrentAnnotationPtr = GraphAnnotationModel::Instance()->NewGraphAnnotation(ImPlot::PixelsToPlot(projected_point));
+                                    m_CurrentAnnotationPtr->SetSignalSerieParent(datas_ptr);
+                                    datas_ptr->addGraphAnnotation(m_CurrentAnnotationPtr);
+                                }
+                            }
 
-                                    // a circle by signal
-                                    draw_list->AddCircle(pos, 5.0f, ImGui::GetColorU32(ProjectFile::Instance()->m_GraphColors.graphHoveredTimeColor), 24, 2.0f);
-
-                                    // draw info tooltip
-                                    ImGui::BeginTooltipEx(ImGuiTooltipFlags_None, ImGuiWindowFlags_None);
-
-                                    if (last_string.empty()) {
-                                        // tofix : to refactor
-                                        const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
-                                        const auto p_max = ImVec2(  //
-                                            p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
-                                            p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
-                                        ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
-                                        const bool pushed = ImGui::PushStyleColorWithContrast4(
-                                            _color, ImGuiCol_Text, ImGui::CustomStyle::puContrastedTextColor, ImGui::CustomStyle::puContrastRatio);
-                                        if (!last_desc.empty()) {
-                                            ImGui::Text("%f (%s)\n%s", last_value, last_desc.c_str(), name_str.c_str());
-                                        } else {
-                                            ImGui::Text("%f\n%s", last_value, name_str.c_str());
-                                        }
-                                        if (pushed)
-                                            ImGui::PopStyleColor();
-                                    } else {
-                                        if (last_status == LogEngine::sc_START_ZONE && current_status == LogEngine::sc_END_ZONE) {
-                                            // tofix : to refactor
-                                            const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
-                                            const auto p_max =
-                                                ImVec2(p_min.x + ImGui::GetContentRegionAvail().x + spacing_R, p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
-                                            ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
-                                            const bool pushed = ImGui::PushStyleColorWithContrast4(
-                                                _color, ImGuiCol_Text, ImGui::CustomStyle::puContrastedTextColor, ImGui::CustomStyle::puContrastRatio);
-                                            ImGui::Text("%s : %s\nElapsed time : %s", name_str.c_str(), last_string.c_str(), _human_readbale_elapsed_time.c_str());
-                                            if (pushed)
-                                                ImGui::PopStyleColor();
-                                        }
-                                    }
+                            // draw vertical cursor
+                            auto pos = ImPlot::PlotToPixels(hovered_time, last_value);
+                            if (!_already_drawn) {
+                                draw_list->AddLine(pos - ImVec2(20.0f, 0.0f), pos + ImVec2(20.0f, 0.0f), _GraphMouseHoveredTimeColor, 1.0f);
+                                _already_drawn = true;
+                            }
 
-                                    ImGui::EndTooltip();
+                            // a circle by signal
+                            draw_list->AddCircle(pos, 5.0f, ImGui::GetColorU32(ProjectFile::Instance()->m_GraphColors.graphHoveredTimeColor), 24, 2.0f);
+
+                            // draw info tooltip
+                            ImGui::BeginTooltipEx(ImGuiTooltipFlags_None, ImGuiWindowFlags_None);
+
+                            if (last_string_id == SignalStringPool::sc_EMPTY_ID) {
+                                // tofix : to refactor
+                                const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
+                                const auto p_max = ImVec2(  //
+                                    p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
+                                    p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
+                                ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
+                                const bool pushed = ImGui::PushStyleColorWithContrast4(
+                                    _color, ImGuiCol_Text, ImGui::CustomStyle::puContrastedTextColor, ImGui::CustomStyle::puContrastRatio);
+                                if (last_desc_id != SignalStringPool::sc_EMPTY_ID) {
+                                    ImGui::Text("%f (%s)\n%s", last_value, LogEngine::Instance()->GetStringPool().get(last_desc_id).c_str(), name_str.c_str());
+                                } else {
+                                    ImGui::Text("%f\n%s", last_value, name_str.c_str());
+                                }
+                                if (pushed)
+                                    ImGui::PopStyleColor();
+                            } else {
+                                if (last_status_id == SignalStringPool::sc_START_ZONE_ID && current_status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                    // tofix : to refactor
+                                    const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
+                                    const auto p_max =
+                                        ImVec2(p_min.x + ImGui::GetContentRegionAvail().x + spacing_R, p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
+                                    ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
+                                    const bool pushed = ImGui::PushStyleColorWithContrast4(
+                                        _color, ImGuiCol_Text, ImGui::CustomStyle::puContrastedTextColor, ImGui::CustomStyle::puContrastRatio);
+                                    ImGui::Text("%s : %s\nElapsed time : %s", name_str.c_str(), LogEngine::Instance()->GetStringPool().get(last_string_id).c_str(), _human_readbale_elapsed_time.c_str());
+                                    if (pushed)
+                                        ImGui::PopStyleColor();
                                 }
-
-                                last_value_pos = value_pos;
-                                last_time = current_time;
-                                last_value = current_value;
-                                last_string = current_string;
-                                last_status = current_status;
-                                last_desc = current_desc;
                             }
+
+                            ImGui::EndTooltip();
                         }
 
-                        // draw annotations
-                        datas_ptr->drawAnnotations();
+                        last_value_pos = value_pos;
+                        last_time = current_time;
+                        last_value = current_value;
+                        last_string_id = current_string_id;
+                        last_status_id = current_status_id;
+                        last_desc_id = current_desc_id;
                     }
+
+                    // draw annotations
+                    datas_ptr->drawAnnotations();
                 }
 
                 ImPlot::EndItem();
             }
 
             if (ImPlot::IsPlotHovered()) {
-                auto date_str = LogEngine::sConvertEpochToDateTimeString(hovered_time);
+                const auto& date_str = LogEngine::Instance()->GetDateTimeString(hovered_time);
 
                 // will finalize the tooltip by adding the current time of the mouse hover pos
                 ImGui::BeginTooltipEx(ImGuiTooltipFlags_None, ImGuiWindowFlags_None);
@@ -785,191 +989,206 @@ void GraphView::DrawGroupedGraphs(const GraphGroupPtr& vGraphGroupPtr, const ImV
                             if (ProjectFile::Instance()->m_ShowVariableSignalsInGraphView && datas_ptr->isConstant()) {
                                 continue;
                             }
-                            const auto& name_str = datas_ptr->category + " / " + datas_ptr->name;
+                            const auto& name_str = datas_ptr->graph_label;
                             if (ImPlot::BeginItem(name_str.c_str())) {
-                                bool _is_zone_reached = false;
+                                // as in GraphGroup::ComputeRange, a zone serie have its row even if its zones are not visible
+                                const bool _is_zone_reached = datas_ptr->is_zone;
 
                                 const float thickness = (float)(datas_ptr->hovered_by_mouse ? _SelectedCurveDisplayThickNess : _DefaultCurveDisplayThickNess);
 
                                 ImPlot::GetCurrentItem()->Color = datas_ptr->color_u32;
 
-                                auto& _data_values = datas_ptr->datas_values;
-                                if (!_data_values.empty()) {
-                                    auto _data_ptr_0 = _data_values.at(0U).lock();
-                                    if (_data_ptr_0) {
-                                        double last_time = _data_ptr_0->time_epoch, current_time;
-                                        double last_value = _data_ptr_0->value, current_value;
-                                        std::string last_string = _data_ptr_0->string, current_string;
-                                        std::string last_status = _data_ptr_0->status, current_status;
-                                        std::string last_desc = _data_ptr_0->desc, current_desc;
-                                        bool _is_h_hovered = false;
-
-                                        last_value_pos = ImPlot::PlotToPixels(last_time, _data_ptr_0->value);
-                                        for (size_t i = 1U; i < _data_values.size(); ++i) {
-                                            auto _data_ptr_i = _data_values.at(i).lock();
-                                            if (_data_ptr_i) {
-                                                current_time = _data_ptr_i->time_epoch;
-                                                current_value = _data_ptr_i->value;
-                                                current_string = _data_ptr_i->string;
-                                                current_status = _data_ptr_i->status;
-                                                current_desc = _data_ptr_i->desc;
-                                                if (i == 1U && !current_desc.empty() && last_desc.empty()) {
-                                                    last_desc = current_desc;
-                                                }
+                                const auto& ticks_time = datas_ptr->ticks_time;
+                                if (!ticks_time.empty()) {
+                                    // the curve or the zones of the serie are drawn at once, so the loop visit only the hovered segment
+                                    size_t hovered_idx = SignalSerie::sc_NO_TICK;
+                                    if (datas_ptr->is_zone) {
+                                        prDrawSignalZones(draw_list, datas_ptr, _ZoneYOffset, _ZoneYOffset + 1.0, datas_ptr->color_u32, true);
+                                        if (ImPlot::IsPlotHovered()) {
+                                            const auto zone_idx = datas_ptr->findZoneIndexAt(hovered_time);
+                                            if (zone_idx != SignalSerie::sc_NO_TICK) {
+                                                hovered_idx = datas_ptr->zones[zone_idx].tick_idx;
+                                            }
+                                        }
+                                    } else {
+                                        prDrawSignalCurve(draw_list, datas_ptr, datas_ptr->color_u32, thickness);
+                                        if (ImPlot::IsPlotHovered()) {
+                                            hovered_idx = datas_ptr->findTickIndexAt(hovered_time, datas_ptr->hover_cursor);
+                                        }
+                                    }
+                                    size_t first_idx = ticks_time.size();
+                                    size_t end_idx = ticks_time.size();
+                                    if (hovered_idx != SignalSerie::sc_NO_TICK) {
+                                        first_idx = hovered_idx + 1U;
+                                        end_idx = hovered_idx + 2U;
+                                    }
 
-                                                value_pos = ImPlot::PlotToPixels(current_time, current_value);
+                                    // current annotation creation
+                                    if (m_CurrentAnnotationPtr) {
+                                        m_CurrentAnnotationPtr->DrawToPoint(datas_ptr, ImGui::GetMousePos());
+                                    }
 
-                                                ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
+                                    double last_time = ticks_time[first_idx - 1U], current_time;
+                                    double last_value = datas_ptr->ticks_value[first_idx - 1U], current_value;
+                                    SignalStringID last_string_id = datas_ptr->ticks_string_id[first_idx - 1U], current_string_id;
+                                    SignalStringID last_status_id = datas_ptr->ticks_status_id[first_idx - 1U], current_status_id;
+                                    SignalStringID last_desc_id = datas_ptr->ticks_desc_id[first_idx - 1U], current_desc_id;
+                                    bool _is_h_hovered = false;
+
+                                    last_value_pos = ImPlot::PlotToPixels(last_time, last_value);
+                                    for (size_t i = first_idx; i < end_idx; ++i) {
+                                        current_time = ticks_time[i];
+                                        current_value = datas_ptr->ticks_value[i];
+                                        current_string_id = datas_ptr->ticks_string_id[i];
+                                        current_status_id = datas_ptr->ticks_status_id[i];
+                                        current_desc_id = datas_ptr->ticks_desc_id[i];
+                                        if (i == 1U && current_desc_id != SignalStringPool::sc_EMPTY_ID && last_desc_id == SignalStringPool::sc_EMPTY_ID) {
+                                            last_desc_id = current_desc_id;
+                                        }
 
-                                                const bool _is_v_hovered = (ImPlot::IsPlotHovered() && hovered_time >= last_time && hovered_time <= current_time);
-                                                ImU32 _color = datas_ptr->color_u32;
+                                        value_pos = ImPlot::PlotToPixels(current_time, current_value);
 
-                                                if (last_string.empty()) {
-                                                    ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
-                                                    draw_list->AddLine(last_value_pos, ImVec2(value_pos.x, last_value_pos.y), _color, thickness);
-                                                    draw_list->AddLine(ImVec2(value_pos.x, last_value_pos.y), value_pos, _color, thickness);
-                                                } else {
-                                                    if (last_status == LogEngine::sc_START_ZONE && current_status == LogEngine::sc_END_ZONE) {
-                                                        _is_zone_reached = true;
-                                                        ImPlot::FitPoint(ImPlotPoint(current_time, _ZoneYOffset));
-                                                        ImPlot::FitPoint(ImPlotPoint(current_time, _ZoneYOffset + 1.0f));
-                                                        ImVec2 last_pos = ImPlot::PlotToPixels(last_time, _ZoneYOffset);
-                                                        ImVec2 cur_pos = ImPlot::PlotToPixels(current_time, _ZoneYOffset + 1.0f);
-                                                        _is_h_hovered = (ImPlot::IsPlotHovered() && mouse_pos.y <= last_pos.y && mouse_pos.y >= cur_pos.y);
-                                                        _color = _is_v_hovered && _is_h_hovered ? _GraphMouseHoveredTimeColor : datas_ptr->color_u32;
-                                                        draw_list->AddRectFilled(last_pos, cur_pos, _color);
-                                                        draw_list->AddRect(last_pos, cur_pos, ImGui::GetColorU32(ImVec4(0, 0, 0, 1)));
-                                                        if (_is_v_hovered && _is_h_hovered) {
-                                                            draw_list->AddRect(last_pos,
-                                                                               cur_pos,
-                                                                               ImGui::GetColorU32(ImVec4(0, 0, 0, 1)),
-                                                                               0.0f,
-                                                                               0,
-                                                                               (float)_SelectedCurveDisplayThickNess);
-                                                        }
-                                                    }
-                                                }
+                                        const bool _is_v_hovered = (ImPlot::IsPlotHovered() && hovered_time >= last_time && hovered_time <= current_time);
+                                        ImU32 _color = datas_ptr->color_u32;
 
-                                                // current annotation creation
-                                                if (m_CurrentAnnotationPtr) {
-                                                    m_CurrentAnnotationPtr->DrawToPoint(datas_ptr, ImGui::GetMousePos());
+                                        if (last_string_id == SignalStringPool::sc_EMPTY_ID) {
+                                            ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
+                                            draw_list->AddLine(last_value_pos, ImVec2(value_pos.x, last_value_pos.y), _color, thickness);
+                                            draw_list->AddLine(ImVec2(value_pos.x, last_value_pos.y), value_pos, _color, thickness);
+                                        } else {
+                                            if (last_status_id == SignalStringPool::sc_START_ZONE_ID && current_status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                                ImPlot::FitPoint(ImPlotPoint(current_time, _ZoneYOffset));
+                                                ImPlot::FitPoint(ImPlotPoint(current_time, _ZoneYOffset + 1.0f));
+                                                ImVec2 last_pos = ImPlot::PlotToPixels(last_time, _ZoneYOffset);
+                                                ImVec2 cur_pos = ImPlot::PlotToPixels(current_time, _ZoneYOffset + 1.0f);
+                                                _is_h_hovered = (ImPlot::IsPlotHovered() && mouse_pos.y <= last_pos.y && mouse_pos.y >= cur_pos.y);
+                                                _color = _is_v_hovered && _is_h_hovered ? _GraphMouseHoveredTimeColor : datas_ptr->color_u32;
+                                                draw_list->AddRectFilled(last_pos, cur_pos, _color);
+                                                draw_list->AddRect(last_pos, cur_pos, ImGui::GetColorU32(ImVec4(0, 0, 0, 1)));
+                                                if (_is_v_hovered && _is_h_hovered) {
+                                                    draw_list->AddRect(last_pos,
+                                                                       cur_pos,
+                                                                       ImGui::GetColorU32(ImVec4(0, 0, 0, 1)),
+                                                                       0.0f,
+                                                                       0,
+                                                                       (float)_SelectedCurveDisplayThickNess);
                                                 }
+                                            }
+                                        }
 
-                                                // draw gizmo for mouse over tick
-                                                if (_is_v_hovered) {
-                                                    // for avoid frame time regeneration of this slow operation
-                                                    // GraphAnnotation::sGetHumanReadableElapsedTime
-                                                    if (_is_h_hovered) {
-                                                        if (_current_hovered_serie != datas_ptr) {
-                                                            _human_readbale_elapsed_time = GraphAnnotation::sGetHumanReadableElapsedTime(current_time - last_time);
-                                                        }
-                                                        _current_hovered_serie = datas_ptr;
-                                                    }
-
-                                                    // mouse hover curve
-                                                    const auto last_pos = ImVec2(value_pos.x, last_value_pos.y);
-                                                    datas_ptr->hovered_by_mouse =
-                                                        GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_value_pos, last_pos, projected_point);
-                                                    if (!datas_ptr->hovered_by_mouse) {
-                                                        datas_ptr->hovered_by_mouse =
-                                                            GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_pos, value_pos, projected_point);
-                                                    }
+                                        // draw gizmo for mouse over tick
+                                        if (_is_v_hovered) {
+                                            // for avoid frame time regeneration of this slow operation
+                                            // GraphAnnotation::sGetHumanReadableElapsedTime
+                                            if (_is_h_hovered) {
+                                                if (_current_hovered_serie != datas_ptr) {
+                                                    _human_readbale_elapsed_time = GraphAnnotation::sGetHumanReadableElapsedTime(current_time - last_time);
+                                                }
+                                                _current_hovered_serie = datas_ptr;
+                                            }
 
-                                                    // annotation start and end points
-                                                    if (ImGui::IsMouseReleased(ImGuiMouseButton_Middle) && datas_ptr->hovered_by_mouse) {
-                                                        if (m_CurrentAnnotationPtr) {
-                                                            if (m_CurrentAnnotationPtr->GetParentSignalSerie().lock() == datas_ptr) {
-                                                                m_CurrentAnnotationPtr->SetEndPoint(ImPlot::PixelsToPlot(projected_point));
-                                                                m_CurrentAnnotationPtr = nullptr;  // remove the "draw to mouse point" of the current annotation
-                                                            }
-                                                        } else {
-                                                            m_CurrentAnnotationPtr =
-                                                                GraphAnnotationModel::Instance()->NewGraphAnnotation(ImPlot::PixelsToPlot(projected_point));
-                                                            m_CurrentAnnotationPtr->SetSignalSerieParent(datas_ptr);
-                                                            datas_ptr->addGraphAnnotation(m_CurrentAnnotationPtr);
-                                                        }
-                                                    }
+                                            // mouse hover curve
+                                            const auto last_pos = ImVec2(value_pos.x, last_value_pos.y);
+                                            datas_ptr->hovered_by_mouse =
+                                                GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_value_pos, last_pos, projected_point);
+                                            if (!datas_ptr->hovered_by_mouse) {
+                                                datas_ptr->hovered_by_mouse =
+                                                    GraphAnnotation::sIsMouseHoverLine(mouse_pos, _CurveRadiusDetection, last_pos, value_pos, projected_point);
+                                            }
 
-                                                    // draw vertical cursor
-                                                    auto pos = ImPlot::PlotToPixels(hovered_time, last_value);
-                                                    if (!_already_drawn) {
-                                                        draw_list->AddLine(pos - ImVec2(20.0f, 0.0f), pos + ImVec2(20.0f, 0.0f), _GraphMouseHoveredTimeColor, 1.0f);
-                                                        _already_drawn = true;
+                                            // annotation start and end points
+                                            if (ImGui::IsMouseReleased(ImGuiMouseButton_Middle) && datas_ptr->hovered_by_mouse) {
+                                                if (m_CurrentAnnotationPtr) {
+                                                    if (m_CurrentAnnotationPtr->GetParentSignalSerie().lock() == datas_ptr) {
+                                                        m_CurrentAnnotationPtr->SetEndPoint(ImPlot::PixelsToPlot(projected_point));
+                                                        m_CurrentAnnotationPtr = nullptr;  // remove the "draw to mouse point" of the current annotation
                                                     }
+                                                } else {
+                                                    m_CurrentAnnotationPtr =
+                                                        GraphAnnotationModel::Instance()->NewGraphAnnotation(ImPlot::PixelsToPlot(projected_point));
+                                                    m_CurrentAnnotationPtr->SetSignalSerieParent(datas_ptr);
+                                                    datas_ptr->addGraphAnnotation(m_CurrentAnnotationPtr);
+                                                }
+                                            }
 
-                                                    // a circle by signal
-                                                    draw_list->AddCircle(
-                                                        pos, 5.0f, ImGui::GetColorU32(ProjectFile::Instance()->m_GraphColors.graphHoveredTimeColor), 24, 2.0f);
-
-                                                    // the first begin tootlip call open the tooltip and add a signal, the next begins will fill it with another signals
-                                                    ImGui::BeginTooltipEx(ImGuiTooltipFlags_None, ImGuiWindowFlags_None);
+                                            // draw vertical cursor
+                                            auto pos = ImPlot::PlotToPixels(hovered_time, last_value);
+                                            if (!_already_drawn) {
+                                                draw_list->AddLine(pos - ImVec2(20.0f, 0.0f), pos + ImVec2(20.0f, 0.0f), _GraphMouseHoveredTimeColor, 1.0f);
+                                                _already_drawn = true;
+                                            }
 
-                                                    if (last_string.empty()) {
+                                            // a circle by signal
+                                            draw_list->AddCircle(
+                                                pos, 5.0f, ImGui::GetColorU32(ProjectFile::Instance()->m_GraphColors.graphHoveredTimeColor), 24, 2.0f);
+
+                                            // the first begin tootlip call open the tooltip and add a signal, the next begins will fill it with another signals
+                                            ImGui::BeginTooltipEx(ImGuiTooltipFlags_None, ImGuiWindowFlags_None);
+
+                                            if (last_string_id == SignalStringPool::sc_EMPTY_ID) {
+                                                // tofix : to refactor
+                                                const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
+                                                const auto p_max = ImVec2(  //
+                                                    p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
+                                                    p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
+                                                ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
+                                                const bool pushed = ImGui::PushStyleColorWithContrast4(
+                                                    _color, ImGuiCol_Text, ImGui::CustomStyle::puContrastedTextColor, ImGui::CustomStyle::puContrastRatio);
+                                                if (last_desc_id != SignalStringPool::sc_EMPTY_ID) {
+                                                    ImGui::Text("%f (%s) %s", last_value, LogEngine::Instance()->GetStringPool().get(last_desc_id).c_str(), name_str.c_str());
+                                                } else {
+                                                    ImGui::Text("%f %s", last_value, name_str.c_str());
+                                                }
+                                                if (pushed)
+                                                    ImGui::PopStyleColor();
+                                            } else {
+                                                if (last_status_id == SignalStringPool::sc_START_ZONE_ID && current_status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                                    if (_current_hovered_serie == datas_ptr) {
                                                         // tofix : to refactor
                                                         const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
-                                                        const auto p_max = ImVec2(  //
-                                                            p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
-                                                            p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
+                                                        const auto p_max = ImVec2(p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
+                                                                                  p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
                                                         ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
-                                                        const bool pushed = ImGui::PushStyleColorWithContrast4(
-                                                            _color, ImGuiCol_Text, ImGui::CustomStyle::puContrastedTextColor, ImGui::CustomStyle::puContrastRatio);
-                                                        if (!last_desc.empty()) {
-                                                            ImGui::Text("%f (%s) %s", last_value, last_desc.c_str(), name_str.c_str());
-                                                        } else {
-                                                            ImGui::Text("%f %s", last_value, name_str.c_str());
-                                                        }
+                                                        const bool pushed = ImGui::PushStyleColorWithContrast4(_color,
+                                                                                                               ImGuiCol_Text,
+                                                                                                               ImGui::CustomStyle::puContrastedTextColor,
+                                                                                                               ImGui::CustomStyle::puContrastRatio);
+                                                        ImGui::Text("%s : %s\nElapsed time : %s",
+                                                                    name_str.c_str(),
+                                                                    LogEngine::Instance()->GetStringPool().get(last_string_id).c_str(),
+                                                                    _human_readbale_elapsed_time.c_str());
                                                         if (pushed)
                                                             ImGui::PopStyleColor();
                                                     } else {
-                                                        if (last_status == LogEngine::sc_START_ZONE && current_status == LogEngine::sc_END_ZONE) {
-                                                            if (_current_hovered_serie == datas_ptr) {
-                                                                // tofix : to refactor
-                                                                const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
-                                                                const auto p_max = ImVec2(p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
-                                                                                          p_min.y + (ImGui::GetFrameHeight() - spacing_D) * 2.0f);
-                                                                ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
-                                                                const bool pushed = ImGui::PushStyleColorWithContrast4(_color,
-                                                                                                                       ImGuiCol_Text,
-                                                                                                                       ImGui::CustomStyle::puContrastedTextColor,
-                                                                                                                       ImGui::CustomStyle::puContrastRatio);
-                                                                ImGui::Text("%s : %s\nElapsed time : %s",
-                                                                            name_str.c_str(),
-                                                                            last_string.c_str(),
-                                                                            _human_readbale_elapsed_time.c_str());
-                                                                if (pushed)
-                                                                    ImGui::PopStyleColor();
-                                                            } else {
-                                                                // tofix : to refactor
-                                                                const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
-                                                                const auto p_max = ImVec2(p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
-                                                                                          p_min.y + (ImGui::GetFrameHeight() - spacing_D));
-                                                                ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
-                                                                const bool pushed = ImGui::PushStyleColorWithContrast4(_color,
-                                                                                                                       ImGuiCol_Text,
-                                                                                                                       ImGui::CustomStyle::puContrastedTextColor,
-                                                                                                                       ImGui::CustomStyle::puContrastRatio);
-                                                                ImGui::Text("%s : %s", name_str.c_str(), last_string.c_str());
-                                                                if (pushed)
-                                                                    ImGui::PopStyleColor();
-                                                            }
-                                                        }
+                                                        // tofix : to refactor
+                                                        const auto p_min = ImGui::GetCursorScreenPos() - ImVec2(spacing_L, spacing_U);
+                                                        const auto p_max = ImVec2(p_min.x + ImGui::GetContentRegionAvail().x + spacing_R,
+                                                                                  p_min.y + (ImGui::GetFrameHeight() - spacing_D));
+                                                        ImGui::GetWindowDrawList()->AddRectFilled(p_min, p_max, _color);
+                                                        const bool pushed = ImGui::PushStyleColorWithContrast4(_color,
+                                                                                                               ImGuiCol_Text,
+                                                                                                               ImGui::CustomStyle::puContrastedTextColor,
+                                                                                                               ImGui::CustomStyle::puContrastRatio);
+                                                        ImGui::Text("%s : %s", name_str.c_str(), LogEngine::Instance()->GetStringPool().get(last_string_id).c_str());
+                                                        if (pushed)
+                                                            ImGui::PopStyleColor();
                                                     }
-
-                                                    ImGui::EndTooltip();
                                                 }
-
-                                                last_value_pos = value_pos;
-                                                last_time = current_time;
-                                                last_value = current_value;
-                                                last_string = current_string;
-                                                last_status = current_status;
-                                                last_desc = current_desc;
                                             }
+
+                                            ImGui::EndTooltip();
                                         }
 
-                                        // draw annotations
-                                        datas_ptr->drawAnnotations();
+                                        last_value_pos = value_pos;
+                                        last_time = current_time;
+                                        last_value = current_value;
+                                        last_string_id = current_string_id;
+                                        last_status_id = current_status_id;
+                                        last_desc_id = current_desc_id;
                                     }
+
+                                    // draw annotations
+                                    datas_ptr->drawAnnotations();
                                 }
 
                                 ImPlot::EndItem();
@@ -984,7 +1203,7 @@ void GraphView::DrawGroupedGraphs(const GraphGroupPtr& vGraphGroupPtr, const ImV
 
                 if (ImPlot::IsPlotHovered()) {
                     ImPlotPoint plotHoveredMouse = ImPlot::GetPlotMousePos();
-                    auto date_str = LogEngine::sConvertEpochToDateTimeString(plotHoveredMouse.x);
+                    const auto& date_str = LogEngine::Instance()->GetDateTimeString(plotHoveredMouse.x);
 
                     // will finalize the tooltip by adding the current time of the mouse hover pos
                     ImGui::BeginTooltipEx(ImGuiTooltipFlags_None, ImGuiWindowFlags_None);
@@ -23,6 +23,15 @@ limitations under the License.
 #include <unordered_map>
 #include <headers/DatasDef.h>
 
+// projected segments of the curve of a value serie, replayed until the view or the serie change
+struct SignalCurveCache {
+    uint64_t serie_version = 0U;
+    ImPlotRect plot_limits;
+    ImVec2 plot_pos;
+    ImVec2 plot_size;
+    std::vector<ImVec2> segments;  // pairs of points, one line by pair
+};
+
 class GraphView {
 private:
     GraphGroups m_GraphGroups;
@@ -33,6 +42,7 @@ private:
     bool m_need_show_hide_y_axis = false;
     int32_t m_GraphsCount = 0;
     GraphAnnotationPtr m_CurrentAnnotationPtr = nullptr;
+    std::unordered_map<SignalID, SignalCurveCache> m_CurveCaches;
 
 public:
     void Clear();
@@ -60,8 +70,18 @@ private:
     void prEraseGroupAt(const size_t& vIdx);
     void prDrawSignalGraph_ImPlot(const SignalSerieWeak& vSignalSerie, const ImVec2& vSize, const bool vFirstGraph);
 
-    bool prBeginPlot(const std::string& vLabel, ez::dvec2 vRangeValue, const ImVec2& vSize, const bool vFirstGraph) const;
+    bool prBeginPlot(const char* vLabel, ez::dvec2 vRangeValue, const ImVec2& vSize, const bool vFirstGraph) const;
     static void prEndPlot(const bool vFirstGraph);
+    // draw the steps of a value serie, with the lod level matching the ticks count by pixel
+    void prDrawSignalCurve(ImDrawList* vDrawListPtr, const SignalSeriePtr& vSeriePtr, const ImU32& vColor, const float& vThickness);
+    // draw the zones of a zone serie between vBottom and vTop, the zones narrower than a pixel are merged in density bars
+    static void prDrawSignalZones(ImDrawList* vDrawListPtr,
+                                  const SignalSeriePtr& vSeriePtr,
+                                  const double& vBottom,
+                                  const double& vTop,
+                                  const ImU32& vColor,
+                                  const bool vOutlined);
+    static void prProjectSignalCurve(const SignalSeriePtr& vSeriePtr, std::vector<ImVec2>& vOutSegments);
 
 public:  // singleton
     static std::shared_ptr<GraphView> Instance() {
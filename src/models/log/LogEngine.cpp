@@ -24,9 +24,12 @@ limitations under the License.
 #include <models/log/SignalTick.h>
 #include <models/log/SignalTag.h>
 #include <models/log/SourceFile.h>
+#include <models/log/SignalSnapshot.h>
 #include <models/graphs/GraphView.h>
 #include <models/database/DataBase.h>
 
+#include <systems/ParallelFor.h>
+
 #include <panes/LogPane.h>
 #include <panes/LogPaneSecondView.h>
 #include <panes/GraphListPane.h>
@@ -36,6 +39,21 @@ limitations under the License.
 
 #include <ezlibs/ezTools.hpp>
 
+// a tick read from the database, before the build of its serie
+struct StagedTick {
+    SignalEpochTime time = 0.0;
+    SignalValue value = 0.0;
+    SignalStringID string_id = 0U;
+    SignalStringID status_id = 0U;
+    SignalStringID desc_id = 0U;
+    SignalID signal_id = -1;
+};
+
+// key of a signal from the rowid of its category and of its name
+static uint64_t sGetSignalKey(const DBRowID& vCategoryID, const DBRowID& vNameID) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(vCategoryID)) << 32U) | static_cast<uint64_t>(static_cast<uint32_t>(vNameID));
+}
+
 ///////////////////////////////////////////////////
 /// STATIC'S //////////////////////////////////////
 ///////////////////////////////////////////////////
@@ -56,9 +74,21 @@ std::string LogEngine::sConvertEpochToDateTimeString(const double& vTime) {
 /// PUBLIC ////////////////////////////////////////
 ///////////////////////////////////////////////////
 
+const SignalDateTime& LogEngine::GetDateTimeString(const SignalEpochTime& vTime) {
+    auto it = m_DateTimeCache.find(vTime);
+    if (it != m_DateTimeCache.end()) {
+        return it->second;
+    }
+    if (m_DateTimeCache.size() >= sc_DATE_TIME_CACHE_SIZE) {
+        m_DateTimeCache.clear();  // the visible rows will be quickly re cached
+    }
+    return m_DateTimeCache[vTime] = sConvertEpochToDateTimeString(vTime);
+}
+
 void LogEngine::Clear() {
     m_Range_ticks_time = SignalValueRange(0.5, -0.5) * DBL_MAX;
     m_SignalSeries.clear();
+    m_SignalSeriesByID.clear();
     m_SignalTicks.clear();
     m_SignalTags.clear();
     m_VirtualTicks.clear();
@@ -67,8 +97,20 @@ void LogEngine::Clear() {
     m_DiffSecondTicks.clear();
     m_DiffResult.clear();
     m_SourceFiles.clear();
+    m_StringPool.clear();
+    m_DateTimeCache.clear();
     m_VisibleCount = 0;
     m_SignalsCount = 0;
+    // the clear of m_SignalTicks is still O(ticks), the blocks are freed at once in ReleaseRetiredArenas
+    // the panes can still have weak ptrs on the control blocks, so the arenas are only retired here
+    m_RetiredArenas.push_back(std::move(m_ArenaPtr));
+    m_ArenaPtr = SignalArena::Create();
+    m_retireWorkerArenas();
+    m_updateMemoryUsage();
+}
+
+void LogEngine::ReleaseRetiredArenas() {
+    m_RetiredArenas.clear();
 }
 
 SourceFileWeak LogEngine::SetSourceFile(const SourceFileName& vSourceFileName) {
@@ -93,45 +135,20 @@ void LogEngine::AddSignalTick(const SourceFileWeak& vSourceFile,
                               const SignalValue& vValue,
                               const SignalDesc& vDesc) {
     if (!vName.empty()) {
-        auto tick_Ptr = SignalTick::Create();
-        tick_Ptr->category = vCategory;
-        tick_Ptr->name = vName;
+        auto serie_ptr = m_getOrCreateSerie(vSourceFile, vCategory, vName, false);
+
+        auto tick_Ptr = SignalTick::Create(m_ArenaPtr);
+        tick_Ptr->signal_id = serie_ptr->id;
         tick_Ptr->time_epoch = vDate;
-        tick_Ptr->time_date_time = LogEngine::sConvertEpochToDateTimeString(vDate);
         tick_Ptr->value = vValue;
-        tick_Ptr->desc = vDesc;
+        tick_Ptr->desc_id = m_StringPool.intern(vDesc);
 
         m_Range_ticks_time.x = ez::mini(m_Range_ticks_time.x, vDate);
         m_Range_ticks_time.y = ez::maxi(m_Range_ticks_time.y, vDate);
 
         m_SignalTicks.push_back(tick_Ptr);
 
-        // ajout de la categorie
-        auto& _datas_cat = m_SignalSeries[vCategory];
-
-        if (_datas_cat.find(vName) == _datas_cat.end())  // first value of the signal
-        {
-            ++m_SignalsCount;
-
-            auto& _datas_name_ptr = _datas_cat[vName] = SignalSerie::Create();
-            if (_datas_name_ptr) {
-                _datas_name_ptr->category = vCategory;
-                _datas_name_ptr->name = vName;
-                _datas_name_ptr->addTick(tick_Ptr, true);
-                _datas_name_ptr->low_case_name_for_search = ez::str::toLower(vName);  // save low case signal name for search
-                _datas_name_ptr->show = false;
-                _datas_name_ptr->m_SourceFileParent = vSourceFile;
-            }
-        } else  // deja existant
-        {
-            auto& _datas_name_ptr = _datas_cat.at(vName);
-            if (_datas_name_ptr) {
-                // on set le time et la valeur de cette frame
-                _datas_name_ptr->addTick(tick_Ptr, true);
-                // by default not visible
-                _datas_name_ptr->show = false;
-            }
-        }
+        serie_ptr->addTick(tick_Ptr, true);
     }
 }
 
@@ -142,46 +159,20 @@ void LogEngine::AddSignalStatus(const SourceFileWeak& vSourceFile,
                                 const SignalString& vString,
                                 const SignalStatus& vStatus) {
     if (!vName.empty()) {
-        auto tick_Ptr = SignalTick::Create();
-        tick_Ptr->category = vCategory;
-        tick_Ptr->name = vName;
+        auto serie_ptr = m_getOrCreateSerie(vSourceFile, vCategory, vName, true);
+
+        auto tick_Ptr = SignalTick::Create(m_ArenaPtr);
+        tick_Ptr->signal_id = serie_ptr->id;
         tick_Ptr->time_epoch = vDate;
-        tick_Ptr->time_date_time = LogEngine::sConvertEpochToDateTimeString(vDate);
-        tick_Ptr->string = vString;
-        tick_Ptr->status = vStatus;
+        tick_Ptr->string_id = m_StringPool.intern(vString);
+        tick_Ptr->status_id = m_StringPool.intern(vStatus);
 
         m_Range_ticks_time.x = ez::mini(m_Range_ticks_time.x, vDate);
         m_Range_ticks_time.y = ez::maxi(m_Range_ticks_time.y, vDate);
 
         m_SignalTicks.push_back(tick_Ptr);
 
-        // ajout de la categorie
-        auto& _datas_cat = m_SignalSeries[vCategory];
-
-        if (_datas_cat.find(vName) == _datas_cat.end())  // first value of the signal
-        {
-            ++m_SignalsCount;
-
-            auto& _datas_name_ptr = _datas_cat[vName] = SignalSerie::Create();
-            if (_datas_name_ptr) {
-                _datas_name_ptr->category = vCategory;
-                _datas_name_ptr->name = vName;
-                _datas_name_ptr->addTick(tick_Ptr, true);
-                _datas_name_ptr->low_case_name_for_search = ez::str::toLower(vName);  // save low case signal name for search
-                _datas_name_ptr->show = false;
-                _datas_name_ptr->m_SourceFileParent = vSourceFile;
-                _datas_name_ptr->is_zone = true;
-            }
-        } else  // deja existant
-        {
-            auto& _datas_name_ptr = _datas_cat.at(vName);
-            if (_datas_name_ptr) {
-                // on set le time et la valeur de cette frame
-                _datas_name_ptr->addTick(tick_Ptr, true);
-                // by default not visible
-                _datas_name_ptr->show = false;
-            }
-        }
+        serie_ptr->addTick(tick_Ptr, true);
     }
 }
 
@@ -192,7 +183,6 @@ void LogEngine::AddSignalTag(const SignalEpochTime& vSignalEpochTime,
     if (!vSignalTagName.empty()) {
         auto tag_Ptr = SignalTag::Create();
         tag_Ptr->time_epoch = vSignalEpochTime;
-        tag_Ptr->time_date_time = LogEngine::sConvertEpochToDateTimeString(vSignalEpochTime);
         tag_Ptr->color = vSignalTagColor;
         tag_Ptr->name = vSignalTagName;
         tag_Ptr->help = vSignalTagHelp;
@@ -202,173 +192,176 @@ void LogEngine::AddSignalTag(const SignalEpochTime& vSignalEpochTime,
 }
 
 void LogEngine::Finalize() {
-    // get sources
-    std::map<SourceFileID, SourceFileWeak> _SourceFiles;
-    DataBase::Instance()->GetSourceFiles([this, &_SourceFiles](const SourceFileID& vSourceFileID, const SourceFilePathName& vSourceFilePathName) {
-        if (_SourceFiles.find(vSourceFileID) == _SourceFiles.end())  // not found
-        {
-            _SourceFiles[vSourceFileID] = SetSourceFile(vSourceFilePathName);
-        }
-    });
-
-    // get datas
-    DataBase::Instance()->GetDatas([this, &_SourceFiles](const SourceFileID& vSourceFileID,
-                                                         const SignalEpochTime& vSignalEpochTime,
-                                                         const SignalCategory& vSignalCategory,
-                                                         const SignalName& vSignalName,
-                                                         const SignalValue& vSignalValue,
-                                                         const SignalString& vSignalString,
-                                                         const SignalStatus& vSignalStatus,
-                                                         const SignalDesc& vSignalDesc) {
-        if (_SourceFiles.find(vSourceFileID) != _SourceFiles.end())  // found
-        {
-            auto source_file_parent_weak = _SourceFiles.at(vSourceFileID);
+    std::atomic<double> progress(0.0);
+    std::atomic<bool> working(true);
+    std::atomic<bool> catalog_ready(false);
+    Finalize(progress, working, catalog_ready);
+}
 
-            if (vSignalString.empty()) {
-                AddSignalTick(source_file_parent_weak, vSignalCategory, vSignalName, vSignalEpochTime, vSignalValue, vSignalDesc);
-            } else {
-                AddSignalStatus(source_file_parent_weak, vSignalCategory, vSignalName, vSignalEpochTime, vSignalString, vSignalStatus);
-            }
+void LogEngine::Finalize(std::atomic<double>& vProgress, std::atomic<bool>& vWorking, std::atomic<bool>& vCatalogReady) {
+    vProgress = 0.0;
+
+    // stage 0 and 1 : the catalogue and the ticks sorted by time
+    // from the snapshot of the previous finalize if any, else from the tables, and the snapshot is saved
+    std::vector<StagedTick> _StagedTicks;
+    if (m_readSnapshot(_StagedTicks, vCatalogReady)) {
+        vProgress = 0.6;
+    } else {
+        m_readDatabase(_StagedTicks, vProgress, vWorking, vCatalogReady);
+        if (!vWorking) {
+            return;
         }
-    });
+        m_writeSnapshot(_StagedTicks);
+    }
+    if (!_StagedTicks.empty()) {
+        m_Range_ticks_time.x = _StagedTicks.front().time;
+        m_Range_ticks_time.y = _StagedTicks.back().time;
+    }
 
-    // get tags
-    DataBase::Instance()->GetTags(
-        [this](const SignalEpochTime& vSignalEpochTime, const SignalTagColor& vSignalTagColor, const SignalTagName& vSignalTagName, const SignalTagHelp& vSignalTagHelp) {
-            AddSignalTag(vSignalEpochTime, vSignalTagColor, vSignalTagName, vSignalTagHelp);
-        });
+    // stage 2 : partition the staged ticks by signal, in time order (counting sort)
+    const auto series_count = m_SignalSeriesByID.size();
+    std::vector<size_t> _SerieOffsets(series_count + 1U, 0U);
+    for (const auto& staged : _StagedTicks) {
+        ++_SerieOffsets[static_cast<size_t>(staged.signal_id) + 1U];
+    }
+    for (size_t idx = 1U; idx <= series_count; ++idx) {
+        _SerieOffsets[idx] += _SerieOffsets[idx - 1U];
+    }
+    std::vector<size_t> _TicksBySerie(_StagedTicks.size());
+    {
+        auto cursors = _SerieOffsets;
+        for (size_t tick_idx = 0U; tick_idx < _StagedTicks.size(); ++tick_idx) {
+            _TicksBySerie[cursors[static_cast<size_t>(_StagedTicks[tick_idx].signal_id)]++] = tick_idx;
+        }
+    }
+    vProgress = 0.65;
+    if (!vWorking) {
+        return;
+    }
 
-    // consolide
-    if (!m_SignalTicks.empty() && m_SignalTicks.front() && m_SignalTicks.back()) {
-        // first tick of all signals
-        auto global_first_time_tick = m_SignalTicks.front()->time_epoch;
+    // stage 3 : build each serie on a thread
+    // each thread have its arena, each tick have its slot in m_SignalTicks, the series are not shared
+    // the first and last virtual ticks are added at the right place, so no front insert
+    m_SignalTicks.resize(_StagedTicks.size());
+    SignalTicksContainer _VirtualTicks(series_count * 2U);
+    const auto threads_count = ParallelFor::GetThreadsCount(series_count);
+    m_retireWorkerArenas();
+    for (size_t idx = 0U; idx < threads_count; ++idx) {
+        m_WorkerArenas.push_back(SignalArena::Create());
+    }
+    const auto global_first_time_tick = _StagedTicks.empty() ? 0.0 : _StagedTicks.front().time;
+    const auto global_last_time_tick = _StagedTicks.empty() ? 0.0 : _StagedTicks.back().time;
+    const bool use_predefined_zero_value = ProjectFile::Instance()->m_UsePredefinedZeroValue;
+    const auto predefined_zero_value = ProjectFile::Instance()->m_PredefinedZeroValue;
+    std::atomic<size_t> built_series_count(0U);
+    ParallelFor::Run(
+        series_count,
+        threads_count,
+        [&](size_t vTaskIdx, size_t vThreadIdx) {
+            ++built_series_count;
+            const auto& serie_ptr = m_SignalSeriesByID[vTaskIdx];
+            const auto& arena_ptr = m_WorkerArenas[vThreadIdx];
+            const auto first_idx = _SerieOffsets[vTaskIdx];
+            const auto last_idx = _SerieOffsets[vTaskIdx + 1U];
+            if (!vWorking || serie_ptr == nullptr || first_idx == last_idx) {
+                return;
+            }
+            serie_ptr->reserveTicks(last_idx - first_idx + 2U);
+
+            // first tick
+            const auto& local_first_tick = _StagedTicks[_TicksBySerie[first_idx]];
+            if (global_first_time_tick < local_first_tick.time) {
+                auto tick_Ptr = SignalTick::Create(arena_ptr);
+                tick_Ptr->signal_id = serie_ptr->id;
+                tick_Ptr->time_epoch = global_first_time_tick;
+                tick_Ptr->value = (use_predefined_zero_value ? predefined_zero_value : local_first_tick.value);
+                _VirtualTicks[vTaskIdx * 2U] = tick_Ptr;  // for retain the shared_pointer
+                serie_ptr->addTick(tick_Ptr, false);
+            }
 
-        // last tick of all signals
-        auto global_last_time_tick = m_SignalTicks.back()->time_epoch;
+            for (size_t idx = first_idx; idx < last_idx; ++idx) {
+                const auto tick_idx = _TicksBySerie[idx];
+                const auto& staged = _StagedTicks[tick_idx];
+                auto tick_Ptr = SignalTick::Create(arena_ptr);
+                tick_Ptr->signal_id = staged.signal_id;
+                tick_Ptr->time_epoch = staged.time;
+                tick_Ptr->value = staged.value;
+                tick_Ptr->string_id = staged.string_id;
+                tick_Ptr->status_id = staged.status_id;
+                tick_Ptr->desc_id = staged.desc_id;
+                m_SignalTicks[tick_idx] = tick_Ptr;
+                serie_ptr->addTick(tick_Ptr, true);
+            }
 
-        // we will add first and last tickes for all signals
-        for (auto& item_cat : m_SignalSeries) {
-            for (auto& item_name : item_cat.second) {
-                if (item_name.second) {
-                    auto local_first_tick_ptr = item_name.second->datas_values.front().lock();
-                    auto local_last_tick_ptr = item_name.second->datas_values.back().lock();
-
-                    if (local_first_tick_ptr && local_last_tick_ptr) {
-                        // first tick
-                        if (global_first_time_tick < local_first_tick_ptr->time_epoch) {
-                            auto tick_Ptr = SignalTick::Create();
-                            tick_Ptr->category = item_cat.first;
-                            tick_Ptr->name = item_name.first;
-                            tick_Ptr->time_epoch = global_first_time_tick;
-                            tick_Ptr->time_date_time = LogEngine::sConvertEpochToDateTimeString(global_first_time_tick);
-                            tick_Ptr->value =
-                                (ProjectFile::Instance()->m_UsePredefinedZeroValue ? //
-                                    ProjectFile::Instance()->m_PredefinedZeroValue : //
-                                    local_first_tick_ptr->value);
-
-                            m_VirtualTicks.push_back(tick_Ptr);  // for retain the shared_pointer
-                            item_name.second->insertTick(tick_Ptr, 0U, false);
-                        }
+            // last tick
+            const auto& local_last_tick = _StagedTicks[_TicksBySerie[last_idx - 1U]];
+            if (global_last_time_tick > local_last_tick.time) {
+                auto tick_Ptr = SignalTick::Create(arena_ptr);
+                tick_Ptr->signal_id = serie_ptr->id;
+                tick_Ptr->time_epoch = global_last_time_tick;
+                tick_Ptr->value = local_last_tick.value;
+                _VirtualTicks[vTaskIdx * 2U + 1U] = tick_Ptr;  // for retain the shared_pointer
+                serie_ptr->addTick(tick_Ptr, false);
+            }
 
-                        // last tick
-                        if (global_last_time_tick > local_last_tick_ptr->time_epoch) {
-                            auto tick_Ptr = SignalTick::Create();
-                            tick_Ptr->category = item_cat.first;
-                            tick_Ptr->name = item_name.first;
-                            tick_Ptr->time_epoch = global_last_time_tick;
-                            tick_Ptr->time_date_time = LogEngine::sConvertEpochToDateTimeString(global_first_time_tick);
-                            tick_Ptr->value = local_last_tick_ptr->value;
-
-                            m_VirtualTicks.push_back(tick_Ptr);  // for retain the shared_pointer
-                            item_name.second->addTick(tick_Ptr, false);
-                        }
-                    }
-                }
+            if (serie_ptr->is_zone) {
+                serie_ptr->buildZones();
+            } else {
+                serie_ptr->buildLod();
             }
+        },
+        [&]() {  //
+            vProgress = 0.65 + 0.35 * static_cast<double>(built_series_count) / static_cast<double>(series_count);
+        });
+
+    for (auto& tick_ptr : _VirtualTicks) {
+        if (tick_ptr != nullptr) {
+            m_VirtualTicks.push_back(tick_ptr);
         }
     }
+    vProgress = 1.0;
+}
 
-    // finalize signals
-    for (auto& signal_cnt : m_SignalSeries) {
-        for (auto& signal : signal_cnt.second) {
-            if (signal.second != nullptr) {
-                signal.second->finalize();
-            }
+void LogEngine::FinalizeViews() {
+    for (const auto& serie_ptr : m_SignalSeriesByID) {
+        if (serie_ptr != nullptr) {
+            serie_ptr->finalize();
         }
     }
 
+    m_updateMemoryUsage();
+
     LogPane::Instance()->Clear();
     LogPaneSecondView::Instance()->Clear();
     GraphListPane::Instance()->UpdateDB();
     ToolPane::Instance()->UpdateTree();
 }
 
-void LogEngine::ShowHideSignal(const SignalCategory& vCategory, const SignalName& vName) {
-    if (m_SignalSeries.find(vCategory) != m_SignalSeries.end()) {
-        auto& cat = m_SignalSeries.at(vCategory);
-        if (cat.find(vName) != cat.end()) {
-            auto& ptr = cat.at(vName);
-            if (ptr) {
-                ptr->show = !ptr->show;
-                m_VisibleCount += ptr->show ? 1 : -1;
-                m_VisibleCount = ez::maxi(m_VisibleCount, 0);
-
-                if (ptr->show) {
-                    GraphView::Instance()->AddSerieToDefaultGroup(ptr);
-                } else {
-                    GraphView::Instance()->RemoveSerieFromGroup(ptr, ptr->graph_groupd_ptr);
-                }
-
-                ProjectFile::Instance()->SetProjectChange();
-                GraphView::Instance()->ComputeGraphsCount();
-                UpdateVisibleSignalsColoring();
-            }
-        }
+void LogEngine::ShowHideSignal(const SignalID& vSignalID) {
+    auto ptr = GetSignalSerie(vSignalID);
+    if (ptr) {
+        m_showHideSerie(ptr, !ptr->show);
     }
 }
 
-void LogEngine::ShowHideSignal(const SignalCategory& vCategory, const SignalName& vName, const bool vFlag) {
-    if (m_SignalSeries.find(vCategory) != m_SignalSeries.end()) {
-        auto& cat = m_SignalSeries.at(vCategory);
-        if (cat.find(vName) != cat.end()) {
-            auto& ptr = cat.at(vName);
-            if (ptr) {
-                ptr->show = vFlag;
-                m_VisibleCount += vFlag ? 1 : -1;
-                m_VisibleCount = ez::maxi(m_VisibleCount, 0);
-
-                if (ptr->show) {
-                    GraphView::Instance()->AddSerieToDefaultGroup(ptr);
-                } else {
-                    GraphView::Instance()->RemoveSerieFromGroup(ptr, ptr->graph_groupd_ptr);
-                }
-
-                ProjectFile::Instance()->SetProjectChange();
-                GraphView::Instance()->ComputeGraphsCount();
-                UpdateVisibleSignalsColoring();
-            }
-        }
+void LogEngine::ShowHideSignal(const SignalID& vSignalID, const bool vFlag) {
+    auto ptr = GetSignalSerie(vSignalID);
+    if (ptr) {
+        m_showHideSerie(ptr, vFlag);
     }
 }
 
-bool LogEngine::isSignalShown(const SignalCategory& vCategory, const SignalName& vName, SignalColor* vOutColorPtr) {
-    bool res = false;
-
-    if (m_SignalSeries.find(vCategory) != m_SignalSeries.end()) {
-        auto& cat = m_SignalSeries.at(vCategory);
-        if (cat.find(vName) != cat.end()) {
-            auto& ptr = cat.at(vName);
-            if (ptr) {
-                if (vOutColorPtr) {
-                    *vOutColorPtr = ptr->color_u32;
-                }
-
-                res = ptr->show;
+bool LogEngine::isSignalShown(const SignalID& vSignalID, SignalColor* vOutColorPtr) const {
+    if (vSignalID >= 0 && static_cast<size_t>(vSignalID) < m_SignalSeriesByID.size()) {
+        const auto& ptr = m_SignalSeriesByID[vSignalID];
+        if (ptr) {
+            if (vOutColorPtr) {
+                *vOutColorPtr = ptr->color_u32;
             }
+            return ptr->show;
         }
     }
-
-    return res;
+    return false;
 }
 
 bool LogEngine::isSomeSelection() const {
@@ -395,6 +388,37 @@ SignalSeriesContainerRef LogEngine::GetSignalSeries() {
     return m_SignalSeries;
 }
 
+SignalSeriePtr LogEngine::GetSignalSerie(const SignalID& vSignalID) const {
+    if (vSignalID >= 0 && static_cast<size_t>(vSignalID) < m_SignalSeriesByID.size()) {
+        return m_SignalSeriesByID[vSignalID];
+    }
+    return nullptr;
+}
+
+const SignalCategory& LogEngine::GetSignalCategory(const SignalID& vSignalID) const {
+    static const SignalCategory s_empty;
+    if (vSignalID >= 0 && static_cast<size_t>(vSignalID) < m_SignalSeriesByID.size() && m_SignalSeriesByID[vSignalID]) {
+        return m_SignalSeriesByID[vSignalID]->category;
+    }
+    return s_empty;
+}
+
+const SignalName& LogEngine::GetSignalName(const SignalID& vSignalID) const {
+    static const SignalName s_empty;
+    if (vSignalID >= 0 && static_cast<size_t>(vSignalID) < m_SignalSeriesByID.size() && m_SignalSeriesByID[vSignalID]) {
+        return m_SignalSeriesByID[vSignalID]->name;
+    }
+    return s_empty;
+}
+
+SignalStringPool& LogEngine::GetStringPool() {
+    return m_StringPool;
+}
+
+const SignalMemoryUsage& LogEngine::GetMemoryUsage() const {
+    return m_MemoryUsage;
+}
+
 void LogEngine::SetHoveredTime(const SignalEpochTime& vHoveredTime, const bool vForce) {
     if (vForce || m_HoveredTime != vHoveredTime) {
         m_HoveredTime = vHoveredTime;
@@ -409,30 +433,26 @@ void LogEngine::SetHoveredTime(const SignalEpochTime& vHoveredTime, const bool v
                     if (ProjectFile::Instance()->m_ShowVariableSignalsInHoveredListView && item_name.second->isConstant()) {
                         continue;
                     }
-                    SignalTickPtr last_ptr = nullptr;
-                    for (const auto& tick_weak : item_name.second->datas_values) {
-                        auto ptr = tick_weak.lock();
-                        if (last_ptr && vHoveredTime >= last_ptr->time_epoch && ptr != nullptr && vHoveredTime <= ptr->time_epoch) {
-                            if (m_PreviewTicks.tryAdd(item_name.second->name, last_ptr)) {
-                                if (ProjectFile::Instance()->m_AutoColorize) {
-                                    auto parent_ptr = last_ptr->parent.lock();
-                                    if (parent_ptr && parent_ptr->show) {
-                                        parent_ptr->color_u32 = ImGui::GetColorU32(ez::getRainBowColor((int32_t)visible_idx, m_VisibleCount));
-                                        parent_ptr->color_v4 = ImGui::ColorConvertU32ToFloat4(parent_ptr->color_u32);
-
-                                        ++visible_idx;
-                                    }
+                    const auto tick_idx = item_name.second->findTickIndexAt(vHoveredTime, item_name.second->hover_cursor);
+                    if (tick_idx != SignalSerie::sc_NO_TICK) {
+                        auto last_ptr = item_name.second->getTick(tick_idx);
+                        if (last_ptr != nullptr && m_PreviewTicks.tryAdd(item_name.second->name, last_ptr)) {
+                            if (ProjectFile::Instance()->m_AutoColorize) {
+                                auto parent_ptr = last_ptr->parent.lock();
+                                if (parent_ptr && parent_ptr->show) {
+                                    parent_ptr->color_u32 = ImGui::GetColorU32(ez::getRainBowColor((int32_t)visible_idx, m_VisibleCount));
+                                    parent_ptr->color_v4 = ImGui::ColorConvertU32ToFloat4(parent_ptr->color_u32);
+
+                                    ++visible_idx;
                                 }
-                                if (last_previewed_ticks.exist(item_name.second->name)) {
-                                    auto last_previewed_tick_ptr = last_previewed_ticks.value(item_name.second->name).lock();
-                                    if (last_previewed_tick_ptr != nullptr) {
-                                        last_ptr->just_changed = ez::isDifferent(last_previewed_tick_ptr->value, last_ptr->value);
-                                    }
+                            }
+                            if (last_previewed_ticks.exist(item_name.second->name)) {
+                                auto last_previewed_tick_ptr = last_previewed_ticks.value(item_name.second->name).lock();
+                                if (last_previewed_tick_ptr != nullptr) {
+                                    last_ptr->just_changed = ez::isDifferent(last_previewed_tick_ptr->value, last_ptr->value);
                                 }
                             }
-                            break;
                         }
-                        last_ptr = ptr;
                     }
                 }
             }
@@ -449,18 +469,13 @@ void LogEngine::UpdateVisibleSignalsColoring() {
         size_t visible_idx = 0U;
         for (auto& item_cat : m_SignalSeries) {
             for (auto& item_name : item_cat.second) {
-                if (item_name.second) {
-                    SignalTickPtr last_ptr = nullptr;
-                    for (const auto& tick_weak : item_name.second->datas_values) {
-                        if (last_ptr) {
-                            auto parent_ptr = last_ptr->parent.lock();
-                            if (parent_ptr && parent_ptr->show) {
-                                parent_ptr->color_u32 = ImGui::GetColorU32(ez::getRainBowColor((int32_t)visible_idx, m_VisibleCount));
-                                parent_ptr->color_v4 = ImGui::ColorConvertU32ToFloat4(parent_ptr->color_u32);
-                                ++visible_idx;
-                            }
-                        }
-                        last_ptr = tick_weak.lock();
+                auto& serie_ptr = item_name.second;
+                if (serie_ptr && serie_ptr->show) {
+                    const auto ticks_count = serie_ptr->getTicksCount();
+                    for (size_t idx = 1U; idx < ticks_count; ++idx) {
+                        serie_ptr->color_u32 = ImGui::GetColorU32(ez::getRainBowColor((int32_t)visible_idx, m_VisibleCount));
+                        serie_ptr->color_v4 = ImGui::ColorConvertU32ToFloat4(serie_ptr->color_u32);
+                        ++visible_idx;
                     }
                 }
             }
@@ -598,21 +613,14 @@ void LogEngine::SetFirstDiffMark(const SignalEpochTime& vSignalEpochTime) {
     for (auto& item_cat : m_SignalSeries) {
         for (auto& item_name : item_cat.second) {
             if (item_name.second) {
-                SignalTickPtr last_ptr = nullptr;
-                for (const auto& tick_weak : item_name.second->datas_values) {
-                    auto ptr = tick_weak.lock();
-                    if (last_ptr && ProjectFile::Instance()->m_DiffFirstMark >= last_ptr->time_epoch && ptr &&
-                        ProjectFile::Instance()->m_DiffFirstMark <= ptr->time_epoch) {
-                        if (idx < (size_t)m_SignalsCount) {
-                            m_DiffFirstTicks[idx] = last_ptr;
-                        } else {
-                            EZ_TOOLS_DEBUG_BREAK;
-                        }
-
-                        break;
+                const auto& mark_time = ProjectFile::Instance()->m_DiffFirstMark;
+                const auto tick_idx = item_name.second->findTickIndexAt(mark_time);
+                if (tick_idx != SignalSerie::sc_NO_TICK) {
+                    if (idx < (size_t)m_SignalsCount) {
+                        m_DiffFirstTicks[idx] = item_name.second->getTick(tick_idx);
+                    } else {
+                        EZ_TOOLS_DEBUG_BREAK;
                     }
-
-                    last_ptr = ptr;
                 }
 
                 ++idx;
@@ -636,21 +644,14 @@ void LogEngine::SetSecondDiffMark(const SignalEpochTime& vSignalEpochTime) {
     for (auto& item_cat : m_SignalSeries) {
         for (auto& item_name : item_cat.second) {
             if (item_name.second) {
-                SignalTickPtr last_ptr = nullptr;
-                for (const auto& tick_weak : item_name.second->datas_values) {
-                    auto ptr = tick_weak.lock();
-                    if (last_ptr && ProjectFile::Instance()->m_DiffSecondMark >= last_ptr->time_epoch && ptr &&
-                        ProjectFile::Instance()->m_DiffSecondMark <= ptr->time_epoch) {
-                        if (idx < (size_t)m_SignalsCount) {
-                            m_DiffSecondTicks[idx] = last_ptr;
-                        } else {
-                            EZ_TOOLS_DEBUG_BREAK;
-                        }
-
-                        break;
+                const auto& mark_time = ProjectFile::Instance()->m_DiffSecondMark;
+                const auto tick_idx = item_name.second->findTickIndexAt(mark_time);
+                if (tick_idx != SignalSerie::sc_NO_TICK) {
+                    if (idx < (size_t)m_SignalsCount) {
+                        m_DiffSecondTicks[idx] = item_name.second->getTick(tick_idx);
+                    } else {
+                        EZ_TOOLS_DEBUG_BREAK;
                     }
-
-                    last_ptr = ptr;
                 }
 
                 ++idx;
@@ -673,7 +674,7 @@ void LogEngine::ComputeDiffResult() {
                 const auto& first_ptr = m_DiffFirstTicks.at(idx).lock();
                 const auto& second_ptr = m_DiffSecondTicks.at(idx).lock();
                 if (first_ptr && second_ptr) {
-                    if (first_ptr->name == second_ptr->name) {
+                    if (first_ptr->signal_id == second_ptr->signal_id) {
                         if (ez::isDifferent(first_ptr->value, second_ptr->value)) {
                             m_DiffResult.emplace_back(first_ptr, second_ptr);
                         }
@@ -689,3 +690,264 @@ void LogEngine::ComputeDiffResult() {
 SignalDiffWeakContainerRef LogEngine::GetDiffResultTicks() {
     return m_DiffResult;
 }
+
+void LogEngine::m_readDatabase(std::vector<StagedTick>& vOutStagedTicks,
+                               std::atomic<double>& vProgress,
+                               std::atomic<bool>& vWorking,
+                               std::atomic<bool>& vCatalogReady) {
+    // get sources
+    std::map<SourceFileID, SourceFileWeak> _SourceFiles;
+    DataBase::Instance()->GetSourceFiles([this, &_SourceFiles](const SourceFileID& vSourceFileID, const SourceFilePathName& vSourceFilePathName) {
+        if (_SourceFiles.find(vSourceFileID) == _SourceFiles.end())  // not found
+        {
+            _SourceFiles[vSourceFileID] = SetSourceFile(vSourceFilePathName);
+        }
+    });
+
+    // get categories and names, few rows, for avoid the join of strings on each tick
+    std::unordered_map<DBRowID, SignalCategory> _Categories;
+    DataBase::Instance()->GetSignalCategories([&_Categories](const DBRowID& vRowID, const SignalCategory& vCategory) {  //
+        _Categories[vRowID] = vCategory;
+    });
+    std::unordered_map<DBRowID, SignalName> _Names;
+    DataBase::Instance()->GetSignalNames([&_Names](const DBRowID& vRowID, const SignalName& vName) {  //
+        _Names[vRowID] = vName;
+    });
+
+    // stage 0 : the catalogue, all the series are created here and no more after
+    // so the signal tree can be displayed while the ticks are read
+    std::unordered_map<uint64_t, SignalID> _SignalIDs;  // (category rowid, name rowid) => signal id
+    size_t _TicksCount = 0U;
+    DataBase::Instance()->GetSignals([this, &_SourceFiles, &_Categories, &_Names, &_SignalIDs, &_TicksCount](const SourceFileID& vSourceFileID,
+                                                                                                            const DBRowID& vCategoryID,
+                                                                                                            const DBRowID& vNameID,
+                                                                                                            const bool vIsStatus,
+                                                                                                            const size_t& vTicksCount) {
+        _TicksCount += vTicksCount;
+        auto source_it = _SourceFiles.find(vSourceFileID);
+        auto name_it = _Names.find(vNameID);
+        if (source_it == _SourceFiles.end() || name_it == _Names.end() || name_it->second.empty()) {
+            return;
+        }
+        auto cat_it = _Categories.find(vCategoryID);
+        const auto& category = (cat_it != _Categories.end()) ? cat_it->second : SignalCategory();
+        auto serie_ptr = m_getOrCreateSerie(source_it->second, category, name_it->second, vIsStatus);
+        serie_ptr->label = serie_ptr->name;  // the ticks count will be added by FinalizeViews
+        _SignalIDs[sGetSignalKey(vCategoryID, vNameID)] = serie_ptr->id;
+    });
+    vCatalogReady = true;
+    vProgress = 0.05;
+    if (!vWorking) {
+        return;
+    }
+
+    // stage 1 : read of the ticks by batchs of columns, sorted by time
+    // the ticks are only staged
+    auto& _StagedTicks = vOutStagedTicks;
+    _StagedTicks.reserve(_TicksCount);
+    if (DataBase::Instance()->OpenTicksCursor(m_StringPool)) {
+        DataBaseTicksBatch batch;
+        while (vWorking && DataBase::Instance()->ReadTicksBatch(batch)) {
+            for (size_t row = 0U; row < batch.size(); ++row) {
+                if (_SourceFiles.find(batch.source_ids[row]) == _SourceFiles.end()) {  // not found
+                    continue;
+                }
+                auto id_it = _SignalIDs.find(sGetSignalKey(batch.category_ids[row], batch.name_ids[row]));
+                if (id_it == _SignalIDs.end()) {  // ignored signal
+                    continue;
+                }
+                StagedTick staged;
+                staged.time = batch.epoch_times[row];
+                staged.signal_id = id_it->second;
+                if (batch.string_ids[row] != SignalStringPool::sc_EMPTY_ID) {
+                    staged.string_id = batch.string_ids[row];
+                    staged.status_id = batch.status_ids[row];
+                } else {
+                    staged.value = batch.values[row];
+                    staged.desc_id = batch.desc_ids[row];
+                }
+                _StagedTicks.push_back(staged);
+            }
+            vProgress = 0.05 + 0.55 * static_cast<double>(_StagedTicks.size()) / static_cast<double>(std::max<size_t>(_TicksCount, 1U));
+        }
+        DataBase::Instance()->CloseTicksCursor();
+    }
+    if (!vWorking) {
+        return;
+    }
+
+    // get tags
+    DataBase::Instance()->GetTags(
+        [this](const SignalEpochTime& vSignalEpochTime, const SignalTagColor& vSignalTagColor, const SignalTagName& vSignalTagName, const SignalTagHelp& vSignalTagHelp) {
+            AddSignalTag(vSignalEpochTime, vSignalTagColor, vSignalTagName, vSignalTagHelp);
+        });
+    vProgress = 0.6;
+}
+
+bool LogEngine::m_readSnapshot(std::vector<StagedTick>& vOutStagedTicks, std::atomic<bool>& vCatalogReady) {
+    SignalSnapshot snapshot;
+    if (!DataBase::Instance()->GetSnapshot(SignalSnapshot::sc_VERSION, snapshot.getDatasRef()) ||  //
+        !snapshot.readHeader(static_cast<uint32_t>(sizeof(StagedTick)))) {
+        return false;
+    }
+
+    // all is read and checked before to touch the model, so a bad snapshot is just ignored
+    std::vector<std::string> _Strings(snapshot.readCount(sizeof(uint32_t)));
+    for (auto& str : _Strings) {
+        str = snapshot.readString();
+    }
+    struct SerieInfos {
+        SignalCategory category;
+        SignalName name;
+        SourceFilePathName source;
+        bool is_zone = false;
+    };
+    std::vector<SerieInfos> _Series(snapshot.readCount(sizeof(uint32_t) * 3U + sizeof(uint8_t)));
+    for (auto& serie : _Series) {
+        serie.category = snapshot.readString();
+        serie.name = snapshot.readString();
+        serie.source = snapshot.readString();
+        serie.is_zone = (snapshot.read<uint8_t>() != 0U);
+    }
+    std::vector<SignalTagPtr> _Tags(snapshot.readCount(sizeof(SignalEpochTime) + sizeof(SignalTagColor) + sizeof(uint32_t) * 2U));
+    for (auto& tag_ptr : _Tags) {
+        tag_ptr = SignalTag::Create();
+        tag_ptr->time_epoch = snapshot.read<SignalEpochTime>();
+        tag_ptr->color = snapshot.read<SignalTagColor>();
+        tag_ptr->name = snapshot.readString();
+        tag_ptr->help = snapshot.readString();
+    }
+    snapshot.readArray(vOutStagedTicks);
+    if (!snapshot.isOk() || _Strings.size() < 3U) {
+        LogVarError("%s", "The snapshot of the datas is corrupted, the datas will be read from the tables");
+        vOutStagedTicks.clear();
+        return false;
+    }
+    for (const auto& staged : vOutStagedTicks) {
+        if (staged.signal_id < 0 || static_cast<size_t>(staged.signal_id) >= _Series.size() ||  //
+            staged.string_id >= _Strings.size() || staged.status_id >= _Strings.size() || staged.desc_id >= _Strings.size()) {
+            LogVarError("%s", "The snapshot of the datas is corrupted, the datas will be read from the tables");
+            vOutStagedTicks.clear();
+            return false;
+        }
+    }
+
+    // the pool of a cleared engine have only the fixed ids, so the ids are the same as in the snapshot
+    for (const auto& str : _Strings) {
+        m_StringPool.intern(str);
+    }
+    for (const auto& serie : _Series) {
+        auto serie_ptr = m_getOrCreateSerie(SetSourceFile(serie.source), serie.category, serie.name, serie.is_zone);
+        serie_ptr->label = serie_ptr->name;  // the ticks count will be added by FinalizeViews
+    }
+    m_SignalTags = std::move(_Tags);
+    vCatalogReady = true;
+    return true;
+}
+
+void LogEngine::m_writeSnapshot(const std::vector<StagedTick>& vStagedTicks) {
+    SignalSnapshot snapshot;
+    snapshot.writeHeader(static_cast<uint32_t>(sizeof(StagedTick)));
+    snapshot.writeCount(m_StringPool.size());
+    for (size_t idx = 0U; idx < m_StringPool.size(); ++idx) {
+        snapshot.writeString(m_StringPool.get(static_cast<SignalStringID>(idx)));
+    }
+    snapshot.writeCount(m_SignalSeriesByID.size());
+    for (const auto& serie_ptr : m_SignalSeriesByID) {
+        auto source_ptr = serie_ptr->m_SourceFileParent.lock();
+        snapshot.writeString(serie_ptr->category);
+        snapshot.writeString(serie_ptr->name);
+        snapshot.writeString((source_ptr != nullptr) ? source_ptr->GetSourceFilePathName() : SourceFilePathName());
+        snapshot.write<uint8_t>(serie_ptr->is_zone ? 1U : 0U);
+    }
+    snapshot.writeCount(m_SignalTags.size());
+    for (const auto& tag_ptr : m_SignalTags) {
+        snapshot.write<SignalEpochTime>(tag_ptr->time_epoch);
+        snapshot.write<SignalTagColor>(tag_ptr->color);
+        snapshot.writeString(tag_ptr->name);
+        snapshot.writeString(tag_ptr->help);
+    }
+    snapshot.writeArray(vStagedTicks);
+    DataBase::Instance()->SetSnapshot(SignalSnapshot::sc_VERSION, snapshot.getDatasRef());
+}
+
+SignalSeriePtr LogEngine::m_getOrCreateSerie(const SourceFileWeak& vSourceFile,
+                                             const SignalCategory& vCategory,
+                                             const SignalName& vName,
+                                             const bool vIsZone) {
+    auto& _datas_cat = m_SignalSeries[vCategory];
+    auto it = _datas_cat.find(vName);
+    if (it != _datas_cat.end()) {  // deja existant
+        return it->second;
+    }
+
+    // first value of the signal
+    ++m_SignalsCount;
+    auto serie_ptr = SignalSerie::Create(m_ArenaPtr);
+    serie_ptr->id = static_cast<SignalID>(m_SignalSeriesByID.size());
+    serie_ptr->category = vCategory;
+    serie_ptr->name = vName;
+    serie_ptr->low_case_name_for_search = ez::str::toLower(vName);  // save low case signal name for search
+    serie_ptr->show = false;                                         // by default not visible
+    serie_ptr->m_SourceFileParent = vSourceFile;
+    serie_ptr->is_zone = vIsZone;
+    _datas_cat[vName] = serie_ptr;
+    m_SignalSeriesByID.push_back(serie_ptr);
+    return serie_ptr;
+}
+
+void LogEngine::m_showHideSerie(const SignalSeriePtr& vSeriePtr, const bool vFlag) {
+    vSeriePtr->show = vFlag;
+    m_VisibleCount += vFlag ? 1 : -1;
+    m_VisibleCount = ez::maxi(m_VisibleCount, 0);
+
+    if (vSeriePtr->show) {
+        GraphView::Instance()->AddSerieToDefaultGroup(vSeriePtr);
+    } else {
+        GraphView::Instance()->RemoveSerieFromGroup(vSeriePtr, vSeriePtr->graph_groupd_ptr);
+    }
+
+    ProjectFile::Instance()->SetProjectChange();
+    GraphView::Instance()->ComputeGraphsCount();
+    UpdateVisibleSignalsColoring();
+}
+
+void LogEngine::m_retireWorkerArenas() {
+    for (auto& arena_ptr : m_WorkerArenas) {
+        m_RetiredArenas.push_back(std::move(arena_ptr));
+    }
+    m_WorkerArenas.clear();
+}
+
+void LogEngine::m_updateMemoryUsage() {
+    m_MemoryUsage = {};
+    for (const auto& arena_ptr : m_WorkerArenas) {
+        m_MemoryUsage.arena_reserved_bytes += arena_ptr->getReservedBytes();
+        m_MemoryUsage.arena_used_bytes += arena_ptr->getUsedBytes();
+        m_MemoryUsage.arena_allocations += arena_ptr->getAllocationsCount();
+    }
+    if (m_ArenaPtr != nullptr) {
+        m_MemoryUsage.arena_reserved_bytes += m_ArenaPtr->getReservedBytes();
+        m_MemoryUsage.arena_used_bytes += m_ArenaPtr->getUsedBytes();
+        m_MemoryUsage.arena_allocations += m_ArenaPtr->getAllocationsCount();
+    }
+    for (const auto& item_cat : m_SignalSeries) {
+        for (const auto& item_name : item_cat.second) {
+            const auto& serie_ptr = item_name.second;
+            if (serie_ptr != nullptr) {
+                m_MemoryUsage.columns_bytes += serie_ptr->datas_values.capacity() * sizeof(SignalTickWeak) +  //
+                    serie_ptr->ticks_time.capacity() * sizeof(SignalEpochTime) +                           //
+                    serie_ptr->ticks_value.capacity() * sizeof(SignalValue) +                              //
+                    (serie_ptr->ticks_string_id.capacity() +                                               //
+                     serie_ptr->ticks_status_id.capacity() +                                               //
+                     serie_ptr->ticks_desc_id.capacity()) * sizeof(SignalStringID);
+                m_MemoryUsage.columns_bytes += serie_ptr->zones.capacity() * sizeof(SignalZone);
+                for (const auto& level : serie_ptr->lod_levels) {
+                    m_MemoryUsage.columns_bytes += level.capacity() * sizeof(SignalLodBucket);
+                }
+            }
+        }
+    }
+    m_MemoryUsage.strings_bytes = m_StringPool.getBytes();
+    m_MemoryUsage.ticks_count = m_SignalTicks.size() + m_VirtualTicks.size();
+}
@@ -18,6 +18,7 @@ limitations under the License.
 
 #include <map>
 #include <mutex>
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <string>
@@ -25,6 +26,10 @@ limitations under the License.
 #include <unordered_map>
 #include <headers/DatasDef.h>
 #include <ezlibs/ezXmlConfig.hpp>
+#include <models/log/SignalArena.h>
+#include <models/log/SignalStringPool.h>
+
+struct StagedTick;  // a tick read from the database, before the build of its serie
 
 struct SignalSetting {
     bool visibility = false;
@@ -32,6 +37,16 @@ struct SignalSetting {
     uint32_t group = 0U;
 };
 
+// memory used by the datas model, updated after each finalize
+struct SignalMemoryUsage {
+    size_t arena_reserved_bytes = 0U;  // blocks of the arena (ticks, series)
+    size_t arena_used_bytes = 0U;
+    size_t arena_allocations = 0U;
+    size_t columns_bytes = 0U;  // columns of the series
+    size_t strings_bytes = 0U;  // string pool
+    size_t ticks_count = 0U;
+};
+
 class LogEngine : public ez::xml::Config {
 private:
     // for searching, so no need the category
@@ -41,15 +56,30 @@ public:
     static std::string sConvertEpochToDateTimeString(const double& vTime);
     static constexpr const char* sc_START_ZONE = "START_ZONE";
     static constexpr const char* sc_END_ZONE = "END_ZONE";
+    static constexpr size_t sc_DATE_TIME_CACHE_SIZE = 4096U;
 
 private:
+    // ticks and series are allocated in this arena, replaced on clear
+    // declared first, so destroyed after the ticks and series
+    SignalArenaPtr m_ArenaPtr = SignalArena::Create();
+    std::vector<SignalArenaPtr> m_WorkerArenas;   // one per thread of the finalize
+    std::vector<SignalArenaPtr> m_RetiredArenas;  // arenas of the cleared model, kept until ReleaseRetiredArenas()
+
     // source file container
     SourceFilesContainer m_SourceFiles;
 
     // containers of ptr's
     SignalSeriesContainer m_SignalSeries;
+    std::vector<SignalSeriePtr> m_SignalSeriesByID;  // same series, indexed by SignalID
     SignalTicksContainer m_SignalTicks;
     SignalTagsContainer m_SignalTags;
+    SignalMemoryUsage m_MemoryUsage;
+
+    // strings of the ticks
+    SignalStringPool m_StringPool;
+
+    // date time strings, formatted only when displayed
+    std::unordered_map<SignalEpochTime, SignalDateTime> m_DateTimeCache;
 
     // ticks container who are not datas, because created virtually
     // like first and last ticks of some signals for being the same as global time
@@ -76,6 +106,9 @@ private:
 
 public:
     void Clear();
+    void ReleaseRetiredArenas();  // only when no pane hold a weak ptr on the cleared ticks and series
+    // formatted date time of an epoch time, cached. the ref is valid until the next call
+    const SignalDateTime& GetDateTimeString(const SignalEpochTime& vTime);
     SourceFileWeak SetSourceFile(const SourceFileName& vSourceFileName);
     void AddSignalTick(const SourceFileWeak& vSourceFile,
                        const SignalCategory& vCategory,
@@ -94,11 +127,16 @@ public:
                       const SignalTagName& vSignalTagName,
                       const SignalTagHelp& vSignalTagHelp);
     void Finalize();
+    // can run on a worker thread, vWorking to false for cancel
+    // vCatalogReady is set when all the series are created, before the read of the ticks
+    void Finalize(std::atomic<double>& vProgress, std::atomic<bool>& vWorking, std::atomic<bool>& vCatalogReady);
+    // to call from the main thread after a Finalize, set the series labels and update the panes
+    void FinalizeViews();
 
     // iter SignalDatasContainer
-    void ShowHideSignal(const SignalCategory& vCategory, const SignalName& vName);
-    void ShowHideSignal(const SignalCategory& vCategory, const SignalName& vName, const bool vFlag);
-    bool isSignalShown(const SignalCategory& vCategory, const SignalName& vName, SignalColor* vOutColorPtr = nullptr);
+    void ShowHideSignal(const SignalID& vSignalID);
+    void ShowHideSignal(const SignalID& vSignalID, const bool vFlag);
+    bool isSignalShown(const SignalID& vSignalID, SignalColor* vOutColorPtr = nullptr) const;
     bool isSomeSelection() const;
 
     SourceFilesContainerRef GetSourceFiles();
@@ -106,6 +144,11 @@ public:
     SignalTicksContainerRef GetSignalTicks();
     SignalTagsContainerRef GetSignalTags();
     SignalSeriesContainerRef GetSignalSeries();
+    SignalSeriePtr GetSignalSerie(const SignalID& vSignalID) const;  // nullptr if not found
+    const SignalCategory& GetSignalCategory(const SignalID& vSignalID) const;
+    const SignalName& GetSignalName(const SignalID& vSignalID) const;
+    SignalStringPool& GetStringPool();
+    const SignalMemoryUsage& GetMemoryUsage() const;
 
     void SetHoveredTime(const SignalEpochTime& vSignalEpochTime, const bool vForce = false);
     double GetHoveredTime() const;
@@ -129,6 +172,19 @@ public:
     void ComputeDiffResult();
     SignalDiffWeakContainerRef GetDiffResultTicks();
 
+private:
+    SignalSeriePtr m_getOrCreateSerie(const SourceFileWeak& vSourceFile, const SignalCategory& vCategory, const SignalName& vName, const bool vIsZone);
+    void m_showHideSerie(const SignalSeriePtr& vSeriePtr, const bool vFlag);
+    void m_updateMemoryUsage();
+    void m_retireWorkerArenas();
+    void m_readDatabase(std::vector<StagedTick>& vOutStagedTicks,
+                        std::atomic<double>& vProgress,
+                        std::atomic<bool>& vWorking,
+                        std::atomic<bool>& vCatalogReady);
+    // false if there is no valid snapshot, the model is not touched in this case
+    bool m_readSnapshot(std::vector<StagedTick>& vOutStagedTicks, std::atomic<bool>& vCatalogReady);
+    void m_writeSnapshot(const std::vector<StagedTick>& vStagedTicks);
+
 public:  // singleton
     static std::shared_ptr<LogEngine> Instance() {
         static auto _instance = std::make_shared<LogEngine>();
@@ -0,0 +1,57 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "SignalArena.h"
+
+SignalArenaPtr SignalArena::Create() {
+    return std::make_shared<SignalArena>();
+}
+
+void* SignalArena::allocate(const size_t& vSize, const size_t& vAlign) {
+    auto address = reinterpret_cast<uintptr_t>(m_CurrentPtr);
+    auto padding = static_cast<size_t>((vAlign - (address % vAlign)) % vAlign);
+    if (m_CurrentPtr == nullptr || padding + vSize > m_CurrentFree) {
+        // new block, the big allocations have their own block
+        const auto block_size = (vSize + vAlign > sc_BLOCK_SIZE) ? vSize + vAlign : sc_BLOCK_SIZE;
+        m_Blocks.push_back(std::make_unique<uint8_t[]>(block_size));
+        m_CurrentPtr = m_Blocks.back().get();
+        m_CurrentFree = block_size;
+        m_ReservedBytes += block_size;
+        address = reinterpret_cast<uintptr_t>(m_CurrentPtr);
+        padding = static_cast<size_t>((vAlign - (address % vAlign)) % vAlign);
+    }
+    auto* res = m_CurrentPtr + padding;
+    m_CurrentPtr += padding + vSize;
+    m_CurrentFree -= padding + vSize;
+    m_UsedBytes += vSize;
+    ++m_AllocationsCount;
+    return res;
+}
+
+size_t SignalArena::getReservedBytes() const {
+    return m_ReservedBytes;
+}
+
+size_t SignalArena::getUsedBytes() const {
+    return m_UsedBytes;
+}
+
+size_t SignalArena::getAllocationsCount() const {
+    return m_AllocationsCount;
+}
@@ -0,0 +1,79 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <headers/DatasDef.h>
+
+// bump allocator of the log datas model (ticks, series and their control blocks)
+// the memory is only given back when the arena is destroyed, in some big blocks
+// not thread safe, an arena must be used by only one thread
+// so LogEngine::Finalize create one arena per worker thread
+class SignalArena {
+public:
+    static constexpr size_t sc_BLOCK_SIZE = 4U * 1024U * 1024U;
+
+    static SignalArenaPtr Create();
+
+private:
+    std::vector<std::unique_ptr<uint8_t[]>> m_Blocks;
+    uint8_t* m_CurrentPtr = nullptr;
+    size_t m_CurrentFree = 0U;
+    size_t m_ReservedBytes = 0U;
+    size_t m_UsedBytes = 0U;
+    size_t m_AllocationsCount = 0U;
+
+public:
+    void* allocate(const size_t& vSize, const size_t& vAlign);
+    size_t getReservedBytes() const;
+    size_t getUsedBytes() const;
+    size_t getAllocationsCount() const;
+};
+
+// std allocator on a SignalArena, for std::allocate_shared
+// the control blocks only keep a raw ptr on the arena, so the arena must outlive
+// every shared and weak ptr on its ticks and series. LogEngine::Clear() retire the arenas,
+// and ProjectFile::ClearDatas() release them with LogEngine::ReleaseRetiredArenas(), once the panes are cleared
+// LogEngine::Clear() is still O(ticks), since the ticks are shared_ptr's destroyed one by one,
+// only the memory is given back at once
+template <typename T>
+class SignalArenaAllocator {
+public:
+    typedef T value_type;
+
+    SignalArena* m_ArenaPtr = nullptr;
+
+public:
+    explicit SignalArenaAllocator(SignalArena* vArenaPtr) : m_ArenaPtr(vArenaPtr) {}
+    template <typename U>
+    SignalArenaAllocator(const SignalArenaAllocator<U>& vOther) : m_ArenaPtr(vOther.m_ArenaPtr) {}
+
+    T* allocate(size_t vCount) { return static_cast<T*>(m_ArenaPtr->allocate(vCount * sizeof(T), alignof(T))); }
+    void deallocate(T*, size_t) {}  // freed with the arena
+
+    template <typename U>
+    bool operator==(const SignalArenaAllocator<U>& vOther) const {
+        return m_ArenaPtr == vOther.m_ArenaPtr;
+    }
+    template <typename U>
+    bool operator!=(const SignalArenaAllocator<U>& vOther) const {
+        return m_ArenaPtr != vOther.m_ArenaPtr;
+    }
+};
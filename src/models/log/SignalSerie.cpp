@@ -18,9 +18,14 @@ limitations under the License.
 */
 
 #include "SignalSerie.h"
+#include <models/log/SignalArena.h>
 #include <models/log/SignalTick.h>
+#include <models/log/SignalStringPool.h>
 #include <models/graphs/GraphAnnotation.h>
 #include <ezlibs/ezStr.hpp>
+#include <algorithm>
+
+static uint64_t s_LastVersion = 0U;  // the versions are unique between the series, a cache can't match another serie
 
 SignalSeriePtr SignalSerie::Create() {
     auto res = std::make_shared<SignalSerie>();
@@ -28,21 +33,22 @@ SignalSeriePtr SignalSerie::Create() {
     return res;
 }
 
-void SignalSerie::insertTick(const SignalTickWeak& vTick, const size_t& vIdx, const bool vIncBaseRecordsCount) {
-    if (vIdx < datas_values.size()) {
-        auto ptr = vTick.lock();
-        if (ptr) {
-            ptr->parent = m_This;
-
-            range_value.x = ez::mini(range_value.x, ptr->value);
-            range_value.y = ez::maxi(range_value.y, ptr->value);
-            datas_values.insert(datas_values.begin() + vIdx, vTick);
-
-            if (vIncBaseRecordsCount) {
-                ++count_base_records;
-            }
-        }
+SignalSeriePtr SignalSerie::Create(const SignalArenaPtr& vArenaPtr) {
+    if (vArenaPtr == nullptr) {
+        return Create();
     }
+    auto res = std::allocate_shared<SignalSerie>(SignalArenaAllocator<SignalSerie>(vArenaPtr.get()));
+    res->m_This = res;
+    return res;
+}
+
+void SignalSerie::reserveTicks(const size_t& vCount) {
+    datas_values.reserve(vCount);
+    ticks_time.reserve(vCount);
+    ticks_value.reserve(vCount);
+    ticks_string_id.reserve(vCount);
+    ticks_status_id.reserve(vCount);
+    ticks_desc_id.reserve(vCount);
 }
 
 void SignalSerie::addTick(const SignalTickWeak& vTick, const bool vIncBaseRecordsCount) {
@@ -53,6 +59,11 @@ void SignalSerie::addTick(const SignalTickWeak& vTick, const bool vIncBaseRecord
         range_value.x = ez::mini(range_value.x, ptr->value);
         range_value.y = ez::maxi(range_value.y, ptr->value);
         datas_values.push_back(vTick);
+        ticks_time.push_back(ptr->time_epoch);
+        ticks_value.push_back(ptr->value);
+        ticks_string_id.push_back(ptr->string_id);
+        ticks_status_id.push_back(ptr->status_id);
+        ticks_desc_id.push_back(ptr->desc_id);
 
         if (vIncBaseRecordsCount) {
             ++count_base_records;
@@ -60,6 +71,191 @@ void SignalSerie::addTick(const SignalTickWeak& vTick, const bool vIncBaseRecord
     }
 }
 
+size_t SignalSerie::getTicksCount() const {
+    return ticks_time.size();
+}
+
+SignalTickPtr SignalSerie::getTick(const size_t& vIdx) const {
+    if (vIdx < datas_values.size()) {
+        return datas_values[vIdx].lock();
+    }
+    return nullptr;
+}
+
+size_t SignalSerie::findTickIndexAt(const SignalEpochTime& vTime) const {
+    const auto it = std::lower_bound(ticks_time.begin(), ticks_time.end(), vTime);
+    return m_getTickIndexFromLowerBound(static_cast<size_t>(it - ticks_time.begin()), vTime);
+}
+
+size_t SignalSerie::findTickIndexAt(const SignalEpochTime& vTime, size_t& vInOutCursor) const {
+    const auto count = ticks_time.size();
+    if (count < 2U) {
+        return sc_NO_TICK;
+    }
+    // galop from the cursor for get the range of the lower bound, then binary search in it
+    const size_t cursor = ez::mini(vInOutCursor, count - 1U);
+    size_t range_start = 0U;
+    size_t range_end = count;
+    size_t step = 1U;
+    if (ticks_time[cursor] < vTime) {
+        size_t lo = cursor;
+        size_t hi = cursor + step;
+        while (hi < count && ticks_time[hi] < vTime) {
+            lo = hi;
+            step *= 2U;
+            hi = lo + step;
+        }
+        range_start = lo + 1U;
+        range_end = ez::mini(hi + 1U, count);
+    } else {
+        size_t hi = cursor;
+        while (hi > 0U) {
+            const size_t probe = (hi > step) ? hi - step : 0U;
+            if (ticks_time[probe] < vTime) {
+                range_start = probe + 1U;
+                break;
+            }
+            hi = probe;
+            step *= 2U;
+        }
+        range_end = hi + 1U;
+    }
+    const auto it = std::lower_bound(ticks_time.begin() + range_start, ticks_time.begin() + range_end, vTime);
+    const auto lower_bound = static_cast<size_t>(it - ticks_time.begin());
+    vInOutCursor = ez::mini(lower_bound, count - 1U);
+    return m_getTickIndexFromLowerBound(lower_bound, vTime);
+}
+
+size_t SignalSerie::m_getTickIndexFromLowerBound(const size_t& vLowerBound, const SignalEpochTime& vTime) const {
+    // same result as the first idx where ticks_time[idx - 1] <= vTime <= ticks_time[idx]
+    if (ticks_time.size() < 2U || vLowerBound >= ticks_time.size()) {
+        return sc_NO_TICK;
+    }
+    if (vLowerBound == 0U) {
+        return (vTime >= ticks_time[0U]) ? 0U : sc_NO_TICK;
+    }
+    return vLowerBound - 1U;
+}
+
+void SignalSerie::getVisibleTicksRange(const SignalEpochTime& vTimeMin,
+                                       const SignalEpochTime& vTimeMax,
+                                       size_t& vOutFirstIdx,
+                                       size_t& vOutEndIdx) const {
+    vOutFirstIdx = vOutEndIdx = 0U;
+    if (ticks_time.empty()) {
+        return;
+    }
+    const auto first_it = std::upper_bound(ticks_time.begin(), ticks_time.end(), vTimeMin);
+    const auto end_it = std::lower_bound(first_it, ticks_time.end(), vTimeMax);
+    vOutFirstIdx = static_cast<size_t>(first_it - ticks_time.begin());
+    vOutFirstIdx = (vOutFirstIdx > 0U) ? vOutFirstIdx - 1U : 0U;
+    vOutEndIdx = ez::mini(static_cast<size_t>(end_it - ticks_time.begin()) + 1U, ticks_time.size());
+}
+
+void SignalSerie::getVisibleBucketsRange(
+    const SignalLodLevel& vLevel, const SignalEpochTime& vTimeMin, const SignalEpochTime& vTimeMax, size_t& vOutFirstIdx, size_t& vOutEndIdx) {
+    vOutFirstIdx = vOutEndIdx = 0U;
+    if (vLevel.empty()) {
+        return;
+    }
+    const auto first_it = std::upper_bound(vLevel.begin(), vLevel.end(), vTimeMin, [](const SignalEpochTime& vTime, const SignalLodBucket& vBucket) {
+        return vTime < vBucket.time_first;
+    });
+    const auto end_it = std::lower_bound(first_it, vLevel.end(), vTimeMax, [](const SignalLodBucket& vBucket, const SignalEpochTime& vTime) {
+        return vBucket.time_first < vTime;
+    });
+    vOutFirstIdx = static_cast<size_t>(first_it - vLevel.begin());
+    vOutFirstIdx = (vOutFirstIdx > 0U) ? vOutFirstIdx - 1U : 0U;
+    vOutEndIdx = ez::mini(static_cast<size_t>(end_it - vLevel.begin()) + 1U, vLevel.size());
+}
+
+void SignalSerie::buildZones() {
+    zones.clear();
+    SignalEpochTime duration_before = 0.0;
+    for (size_t idx = 1U; idx < ticks_time.size(); ++idx) {
+        if (ticks_status_id[idx - 1U] == SignalStringPool::sc_START_ZONE_ID && ticks_status_id[idx] == SignalStringPool::sc_END_ZONE_ID) {
+            SignalZone zone;
+            zone.time_start = ticks_time[idx - 1U];
+            zone.time_end = ticks_time[idx];
+            zone.duration_before = duration_before;
+            zone.tick_idx = idx - 1U;
+            zones.push_back(zone);
+            duration_before += zone.time_end - zone.time_start;
+        }
+    }
+}
+
+size_t SignalSerie::findZoneIndexAt(const SignalEpochTime& vTime) const {
+    const auto it = std::upper_bound(zones.begin(), zones.end(), vTime, [](const SignalEpochTime& vValue, const SignalZone& vZone) {
+        return vValue < vZone.time_start;
+    });
+    if (it != zones.begin()) {
+        const auto idx = static_cast<size_t>(it - zones.begin()) - 1U;
+        if (vTime <= zones[idx].time_end) {
+            return idx;
+        }
+    }
+    return sc_NO_TICK;
+}
+
+void SignalSerie::buildLod() {
+    lod_levels.clear();
+    if (ticks_time.size() < sc_LOD_FACTOR * sc_LOD_MIN_BUCKETS) {
+        return;  // the ticks are few enough
+    }
+
+    // first level, from the ticks
+    SignalLodLevel level;
+    level.reserve(ticks_time.size() / sc_LOD_FACTOR + 1U);
+    for (size_t idx = 0U; idx < ticks_time.size(); idx += sc_LOD_FACTOR) {
+        const auto end_idx = ez::mini(idx + sc_LOD_FACTOR, ticks_time.size());
+        SignalLodBucket bucket;
+        bucket.time_first = ticks_time[idx];
+        bucket.time_last = ticks_time[end_idx - 1U];
+        bucket.value_first = ticks_value[idx];
+        bucket.value_last = ticks_value[end_idx - 1U];
+        bucket.value_min = bucket.value_max = ticks_value[idx];
+        for (size_t sub_idx = idx + 1U; sub_idx < end_idx; ++sub_idx) {
+            bucket.value_min = ez::mini(bucket.value_min, ticks_value[sub_idx]);
+            bucket.value_max = ez::maxi(bucket.value_max, ticks_value[sub_idx]);
+        }
+        level.push_back(bucket);
+    }
+    lod_levels.push_back(std::move(level));
+
+    // next levels, from the previous level
+    while (lod_levels.back().size() >= sc_LOD_FACTOR * sc_LOD_MIN_BUCKETS) {
+        const auto& prev_level = lod_levels.back();
+        SignalLodLevel next_level;
+        next_level.reserve(prev_level.size() / sc_LOD_FACTOR + 1U);
+        for (size_t idx = 0U; idx < prev_level.size(); idx += sc_LOD_FACTOR) {
+            const auto end_idx = ez::mini(idx + sc_LOD_FACTOR, prev_level.size());
+            SignalLodBucket bucket = prev_level[idx];
+            bucket.time_last = prev_level[end_idx - 1U].time_last;
+            bucket.value_last = prev_level[end_idx - 1U].value_last;
+            for (size_t sub_idx = idx + 1U; sub_idx < end_idx; ++sub_idx) {
+                bucket.value_min = ez::mini(bucket.value_min, prev_level[sub_idx].value_min);
+                bucket.value_max = ez::maxi(bucket.value_max, prev_level[sub_idx].value_max);
+            }
+            next_level.push_back(bucket);
+        }
+        lod_levels.push_back(std::move(next_level));
+    }
+}
+
+const SignalLodLevel* SignalSerie::getLodLevel(const double& vTicksPerPixel) const {
+    const SignalLodLevel* res = nullptr;
+    double bucket_ticks_count = static_cast<double>(sc_LOD_FACTOR);
+    for (const auto& level : lod_levels) {
+        if (bucket_ticks_count > vTicksPerPixel) {
+            break;
+        }
+        res = &level;
+        bucket_ticks_count *= static_cast<double>(sc_LOD_FACTOR);
+    }
+    return res;
+}
+
 void SignalSerie::addGraphAnnotation(GraphAnnotationWeak vGraphAnnotation) {
     m_GraphAnnotations.push_back(vGraphAnnotation);
 }
@@ -75,6 +271,8 @@ void SignalSerie::drawAnnotations() {
 
 void SignalSerie::finalize() {
     label = ez::str::toStr("%s (%u)", name.c_str(), static_cast<uint32_t>(count_base_records));
+    graph_label = category + " / " + name;
+    version = ++s_LastVersion;
 }
 
 bool SignalSerie::isConstant() {
@@ -24,9 +24,33 @@ limitations under the License.
 #include <headers/DatasDef.h>
 #include <ezlibs/ezVec2.hpp>
 
+// bucket of a level of the lod pyramid, summary of consecutive ticks
+struct SignalLodBucket {
+    SignalEpochTime time_first = 0.0;
+    SignalEpochTime time_last = 0.0;
+    SignalValue value_first = 0.0;
+    SignalValue value_last = 0.0;
+    SignalValue value_min = 0.0;
+    SignalValue value_max = 0.0;
+};
+typedef std::vector<SignalLodBucket> SignalLodLevel;
+
+// a START_ZONE tick followed by a END_ZONE tick
+struct SignalZone {
+    SignalEpochTime time_start = 0.0;
+    SignalEpochTime time_end = 0.0;
+    SignalEpochTime duration_before = 0.0;  // sum of the durations of the previous zones, for the density of a range of zones
+    size_t tick_idx = 0U;                   // index of the START_ZONE tick
+};
+
 class SignalSerie {
 public:
+    static constexpr size_t sc_NO_TICK = static_cast<size_t>(-1);
+    static constexpr size_t sc_LOD_FACTOR = 8U;        // count of ticks (or buckets) summarized by a bucket of the next level
+    static constexpr size_t sc_LOD_MIN_BUCKETS = 64U;  // no more level under this buckets count
+
     static SignalSeriePtr Create();
+    static SignalSeriePtr Create(const SignalArenaPtr& vArenaPtr);  // allocated in the arena if not null
 
 public:
     SignalSerieWeak m_This;
@@ -36,10 +60,30 @@ public:
     SignalValueRange range_value = SignalValueRange(0.5, -0.5) * DBL_MAX;
     GraphGroupPtr graph_groupd_ptr = nullptr;
     std::vector<SignalTickWeak> datas_values;
+
+    // columnar datas of the ticks, in the same order as datas_values
+    // the scans (rendering, hover, filtering) use these and not the ticks
+    std::vector<SignalEpochTime> ticks_time;
+    std::vector<SignalValue> ticks_value;
+    std::vector<SignalStringID> ticks_string_id;
+    std::vector<SignalStringID> ticks_status_id;
+    std::vector<SignalStringID> ticks_desc_id;
+    size_t hover_cursor = 0U;  // tick index of the last hover query, the next one is often near
+
+    // min/max pyramid of the ticks, for draw the curve at a cost of the plot width and not of the ticks count
+    // the buckets of the level N summarize sc_LOD_FACTOR^(N+1) ticks, built by buildLod
+    std::vector<SignalLodLevel> lod_levels;
+
+    // zones of a zone serie, sorted and not overlapping, built by buildZones
+    std::vector<SignalZone> zones;
+
+    SignalID id = -1;  // index in the LogEngine, the ticks refer to the serie with it
     SignalCategory category;
     SignalName name;
     bool is_zone = false;
     std::string label; // label displayed by imgui
+    uint64_t version = 0U;  // changed by each finalize, for the caches of the views
+    std::string graph_label;  // "category / name", item label of the graphs, cached for not build it each frame
     uint32_t color_u32 = ImGui::GetColorU32(ImVec4(0, 0, 0, 1));
     ImVec4 color_v4 = ImVec4(0, 0, 0, 1);
 
@@ -52,8 +96,34 @@ public:                 // to save
     bool show = false;  // signal must be shown on graph screen
 
 public:
-    void insertTick(const SignalTickWeak& vTick, const size_t& vIdx, const bool vIncBaseRecordsCount = false);
+    void reserveTicks(const size_t& vCount);
     void addTick(const SignalTickWeak& vTick, const bool vIncBaseRecordsCount = false);
+    size_t getTicksCount() const;
+    SignalTickPtr getTick(const size_t& vIdx) const;  // nullptr if not found
+
+    // index of the tick starting the segment [tick, next tick] who contain vTime, sc_NO_TICK if out of the serie
+    // ticks_time is sorted, so binary search
+    size_t findTickIndexAt(const SignalEpochTime& vTime) const;
+    // same, but the search start from vInOutCursor and galop to the result, who is saved in vInOutCursor
+    // so nearby queries (mouse moves) cost only some comparisons
+    size_t findTickIndexAt(const SignalEpochTime& vTime, size_t& vInOutCursor) const;
+
+    // range [vOutFirstIdx, vOutEndIdx) of the ticks between vTimeMin and vTimeMax
+    // with the tick before and the tick after, for draw the segments crossing the bounds
+    void getVisibleTicksRange(const SignalEpochTime& vTimeMin, const SignalEpochTime& vTimeMax, size_t& vOutFirstIdx, size_t& vOutEndIdx) const;
+    // same for the buckets of a lod level
+    static void getVisibleBucketsRange(
+        const SignalLodLevel& vLevel, const SignalEpochTime& vTimeMin, const SignalEpochTime& vTimeMax, size_t& vOutFirstIdx, size_t& vOutEndIdx);
+
+    // build the zones from the columns, once all the ticks are added
+    void buildZones();
+    // index in zones of the zone who contain vTime, sc_NO_TICK if not in a zone
+    size_t findZoneIndexAt(const SignalEpochTime& vTime) const;
+
+    // build the lod pyramid from the columns, once all the ticks are added
+    void buildLod();
+    // the lod level where a bucket is not more than vTicksPerPixel ticks, nullptr if the ticks must be used
+    const SignalLodLevel* getLodLevel(const double& vTicksPerPixel) const;
 
     void addGraphAnnotation(GraphAnnotationWeak vGraphAnnotation);
 
@@ -61,4 +131,7 @@ public:
 
     bool isConstant();
     void finalize();
+
+private:
+    size_t m_getTickIndexFromLowerBound(const size_t& vLowerBound, const SignalEpochTime& vTime) const;
 };
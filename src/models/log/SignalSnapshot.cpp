@@ -0,0 +1,76 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "SignalSnapshot.h"
+
+std::vector<uint8_t>& SignalSnapshot::getDatasRef() {
+    return m_Datas;
+}
+
+bool SignalSnapshot::isOk() const {
+    return !m_ReadError;
+}
+
+void SignalSnapshot::writeHeader(const uint32_t& vTickSize) {
+    write<uint32_t>(sc_BYTE_ORDER_MARK);
+    write<uint32_t>(vTickSize);
+}
+
+bool SignalSnapshot::readHeader(const uint32_t& vTickSize) {
+    m_ReadPos = 0U;
+    m_ReadError = false;
+    const auto byte_order_mark = read<uint32_t>();
+    const auto tick_size = read<uint32_t>();
+    return isOk() && byte_order_mark == sc_BYTE_ORDER_MARK && tick_size == vTickSize;
+}
+
+void SignalSnapshot::writeString(const std::string& vString) {
+    write<uint32_t>(static_cast<uint32_t>(vString.size()));
+    m_Datas.insert(m_Datas.end(), vString.begin(), vString.end());
+}
+
+std::string SignalSnapshot::readString() {
+    std::string res;
+    const auto len = read<uint32_t>();
+    if (m_canRead(len)) {
+        res.assign(reinterpret_cast<const char*>(m_Datas.data() + m_ReadPos), len);
+        m_ReadPos += len;
+    }
+    return res;
+}
+
+void SignalSnapshot::writeCount(const size_t& vCount) {
+    write<uint32_t>(static_cast<uint32_t>(vCount));
+}
+
+size_t SignalSnapshot::readCount(const size_t& vItemMinSize) {
+    const auto count = static_cast<size_t>(read<uint32_t>());
+    if (isOk() && count > (m_Datas.size() - m_ReadPos) / vItemMinSize) {
+        m_ReadError = true;
+    }
+    return isOk() ? count : 0U;
+}
+
+bool SignalSnapshot::m_canRead(const size_t& vSize) {
+    if (m_ReadError || vSize > m_Datas.size() - m_ReadPos) {
+        m_ReadError = true;
+        return false;
+    }
+    return true;
+}
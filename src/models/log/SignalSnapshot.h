@@ -0,0 +1,94 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// binary snapshot of the datas read by LogEngine::Finalize, saved in the project database
+// the pod arrays are copied as is, so the header check the byte order and the size of the ticks
+class SignalSnapshot {
+public:
+    static constexpr uint32_t sc_VERSION = 1U;
+    static constexpr uint32_t sc_BYTE_ORDER_MARK = 0x01020304U;
+
+private:
+    std::vector<uint8_t> m_Datas;
+    size_t m_ReadPos = 0U;
+    bool m_ReadError = false;
+
+public:
+    std::vector<uint8_t>& getDatasRef();
+    bool isOk() const;  // false if a read was out of the datas
+
+    void writeHeader(const uint32_t& vTickSize);
+    bool readHeader(const uint32_t& vTickSize);
+
+    void writeString(const std::string& vString);
+    std::string readString();
+
+    // count of items written before the items, checked with the min size of an item
+    // so a bad count cant allocate more than the datas
+    void writeCount(const size_t& vCount);
+    size_t readCount(const size_t& vItemMinSize);
+
+    template <typename T>
+    void write(const T& vValue) {
+        static_assert(std::is_trivially_copyable<T>::value, "only pod's");
+        const auto* ptr = reinterpret_cast<const uint8_t*>(&vValue);
+        m_Datas.insert(m_Datas.end(), ptr, ptr + sizeof(T));
+    }
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_trivially_copyable<T>::value, "only pod's");
+        T res{};
+        if (m_canRead(sizeof(T))) {
+            std::memcpy(&res, m_Datas.data() + m_ReadPos, sizeof(T));
+            m_ReadPos += sizeof(T);
+        }
+        return res;
+    }
+
+    template <typename T>
+    void writeArray(const std::vector<T>& vArray) {
+        static_assert(std::is_trivially_copyable<T>::value, "only pod's");
+        write<uint64_t>(vArray.size());
+        const auto* ptr = reinterpret_cast<const uint8_t*>(vArray.data());
+        m_Datas.insert(m_Datas.end(), ptr, ptr + vArray.size() * sizeof(T));
+    }
+
+    template <typename T>
+    bool readArray(std::vector<T>& vOutArray) {
+        static_assert(std::is_trivially_copyable<T>::value, "only pod's");
+        const auto count = read<uint64_t>();
+        if (count > (m_Datas.size() - m_ReadPos) / sizeof(T) || !m_canRead(count * sizeof(T))) {
+            m_ReadError = true;
+            return false;
+        }
+        vOutArray.resize(static_cast<size_t>(count));
+        std::memcpy(vOutArray.data(), m_Datas.data() + m_ReadPos, static_cast<size_t>(count) * sizeof(T));
+        m_ReadPos += static_cast<size_t>(count) * sizeof(T);
+        return true;
+    }
+
+private:
+    bool m_canRead(const size_t& vSize);
+};
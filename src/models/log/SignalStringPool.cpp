@@ -0,0 +1,76 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "SignalStringPool.h"
+#include <models/log/LogEngine.h>
+
+SignalStringPool::SignalStringPool() {
+    clear();
+}
+
+void SignalStringPool::clear() {
+    m_Strings.clear();
+    m_IDs.clear();
+    // the fixed ids, not with the const char* overload who dont store the empty string
+    intern(std::string_view());
+    intern(std::string_view(LogEngine::sc_START_ZONE));
+    intern(std::string_view(LogEngine::sc_END_ZONE));
+}
+
+SignalStringID SignalStringPool::intern(const std::string_view& vString) {
+    auto it = m_IDs.find(vString);
+    if (it != m_IDs.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<SignalStringID>(m_Strings.size());
+    m_Strings.emplace_back(vString);
+    m_IDs[m_Strings.back()] = id;
+    return id;
+}
+
+SignalStringID SignalStringPool::intern(const std::string& vString) {
+    return intern(std::string_view(vString));
+}
+
+SignalStringID SignalStringPool::intern(const char* vString) {
+    if (vString == nullptr || vString[0] == '\0') {
+        return sc_EMPTY_ID;
+    }
+    return intern(std::string_view(vString));
+}
+
+const std::string& SignalStringPool::get(const SignalStringID& vID) const {
+    if (vID < m_Strings.size()) {
+        return m_Strings[vID];
+    }
+    return m_Strings[sc_EMPTY_ID];
+}
+
+size_t SignalStringPool::size() const {
+    return m_Strings.size();
+}
+
+size_t SignalStringPool::getBytes() const {
+    size_t res = 0U;
+    for (const auto& str : m_Strings) {
+        // the key of m_IDs is a view on the string
+        res += sizeof(std::string) + str.capacity() + sizeof(std::string_view) + sizeof(SignalStringID);
+    }
+    return res;
+}
@@ -0,0 +1,46 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <headers/DatasDef.h>
+
+// interned strings of the ticks (string, status, desc)
+// each distinct string is stored once, the ticks only keep a SignalStringID
+class SignalStringPool {
+public:
+    static constexpr SignalStringID sc_EMPTY_ID = 0U;
+    static constexpr SignalStringID sc_START_ZONE_ID = 1U;
+    static constexpr SignalStringID sc_END_ZONE_ID = 2U;
+
+private:
+    std::deque<std::string> m_Strings;  // deque, so the refs stay valid when a string is added
+    std::unordered_map<std::string_view, SignalStringID> m_IDs;  // keys are views on m_Strings, so no copy and no alloc for a lookup
+
+public:
+    SignalStringPool();
+    void clear();
+    SignalStringID intern(const std::string_view& vString);
+    SignalStringID intern(const std::string& vString);
+    SignalStringID intern(const char* vString);  // nullptr is the empty string
+    const std::string& get(const SignalStringID& vID) const;
+    size_t size() const;
+    size_t getBytes() const;  // approximate memory used by the strings
+};
@@ -32,7 +32,6 @@ private:
 
 public:
     SignalEpochTime time_epoch = 0.0;
-    SignalDateTime time_date_time;
     SignalTagColor color;
     SignalTagName name;
     SignalTagHelp help;
@@ -18,9 +18,45 @@ limitations under the License.
 */
 
 #include "SignalTick.h"
+#include <models/log/SignalArena.h>
+#include <models/log/LogEngine.h>
+#include <models/log/SignalStringPool.h>
 
 SignalTickPtr SignalTick::Create() {
     auto res = std::make_shared<SignalTick>();
     res->m_This = res;
     return res;
 }
+
+SignalTickPtr SignalTick::Create(const SignalArenaPtr& vArenaPtr) {
+    if (vArenaPtr == nullptr) {
+        return Create();
+    }
+    auto res = std::allocate_shared<SignalTick>(SignalArenaAllocator<SignalTick>(vArenaPtr.get()));
+    res->m_This = res;
+    return res;
+}
+
+const SignalDateTime& SignalTick::getDateTime() const {
+    return LogEngine::Instance()->GetDateTimeString(time_epoch);
+}
+
+const SignalCategory& SignalTick::getCategory() const {
+    return LogEngine::Instance()->GetSignalCategory(signal_id);
+}
+
+const SignalName& SignalTick::getName() const {
+    return LogEngine::Instance()->GetSignalName(signal_id);
+}
+
+const SignalString& SignalTick::getString() const {
+    return LogEngine::Instance()->GetStringPool().get(string_id);
+}
+
+const SignalStatus& SignalTick::getStatus() const {
+    return LogEngine::Instance()->GetStringPool().get(status_id);
+}
+
+const SignalDesc& SignalTick::getDesc() const {
+    return LogEngine::Instance()->GetStringPool().get(desc_id);
+}
@@ -26,19 +26,26 @@ limitations under the License.
 class SignalTick {
 public:
     static SignalTickPtr Create();
+    static SignalTickPtr Create(const SignalArenaPtr& vArenaPtr);  // allocated in the arena if not null
 
 private:
     SignalTickWeak m_This;
 
 public:
     SignalEpochTime time_epoch = 0.0;
-    SignalDateTime time_date_time;
-    SignalCategory category;
-    SignalName name;
+    SignalID signal_id = -1;  // serie of the tick, for get the category and the name
     SignalValue value = 0.0;
-    SignalString string;
-    SignalStatus status;
-    SignalDesc desc;
+    SignalStringID string_id = 0U;  // interned in the SignalStringPool of the LogEngine
+    SignalStringID status_id = 0U;
+    SignalStringID desc_id = 0U;
     SignalSerieWeak parent;
     bool just_changed = false; // for hovered list view
+
+public:
+    const SignalDateTime& getDateTime() const;  // formatted on demand
+    const SignalCategory& getCategory() const;
+    const SignalName& getName() const;
+    const SignalString& getString() const;
+    const SignalStatus& getStatus() const;
+    const SignalDesc& getDesc() const;
 };
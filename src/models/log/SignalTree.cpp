@@ -90,9 +90,11 @@ void SignalTree::displayItemRecurs(SignalItem& vSignalItemRef, bool vCollapseAll
         if (!signal.second.expired()) {
             auto ptr = signal.second.lock();
             if (ptr) {
-                if (ImGui::Selectable(ptr->label.c_str(), ptr->show)) {
+                // the ticks of the series are not ready during the load of the project
+                const auto flags = ProjectFile::Instance()->IsLoading() ? ImGuiSelectableFlags_Disabled : ImGuiSelectableFlags_None;
+                if (ImGui::Selectable(ptr->label.c_str(), ptr->show, flags)) {
                     ptr->show = !ptr->show;
-                    LogEngine::Instance()->ShowHideSignal(ptr->category, ptr->name, ptr->show);
+                    LogEngine::Instance()->ShowHideSignal(ptr->id, ptr->show);
                     if (ProjectFile::Instance()->m_CollapseLogSelection) {
                         LogPane::Instance()->PrepareLog();
                     }
@@ -0,0 +1,205 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "LineReader.h"
+
+#include <cstring>
+#include <algorithm>
+
+#ifdef WIN32
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+LineRange::LineRange(const char* vDatas, const size_t& vBegin, const size_t& vEnd) : m_Datas(vDatas), m_Offset(vBegin), m_End(vEnd) {}
+
+size_t LineRange::getOffset() const {
+    return m_Offset;
+}
+
+size_t LineRange::getEnd() const {
+    return m_End;
+}
+
+int32_t LineRange::countLines() const {
+    int32_t count = 0;
+    const char* ptr = m_Datas + m_Offset;
+    const char* end = m_Datas + m_End;
+    while (ptr < end) {
+        const char* eol = static_cast<const char*>(memchr(ptr, '\n', static_cast<size_t>(end - ptr)));
+        if (eol == nullptr) {
+            eol = end;
+        }
+        if (eol != ptr) {
+            ++count;
+        }
+        ptr = eol + 1;
+    }
+    return count;
+}
+
+bool LineRange::nextLine(std::string_view& vOutLine) {
+    while (m_Offset < m_End) {
+        const char* ptr = m_Datas + m_Offset;
+        const size_t remaining = m_End - m_Offset;
+        const char* eol = static_cast<const char*>(memchr(ptr, '\n', remaining));
+        const size_t len = (eol != nullptr) ? static_cast<size_t>(eol - ptr) : remaining;
+        m_Offset += len + 1U;
+        if (len > 0U) {  // empty lines are skipped like ez::str::splitStringToVector do
+            vOutLine = std::string_view(ptr, len);
+            return true;
+        }
+    }
+    m_Offset = m_End;
+    return false;
+}
+
+LineReader::~LineReader() {
+    close();
+}
+
+bool LineReader::open(const SourceFilePathName& vFilePathName) {
+    close();
+#ifdef WIN32
+    HANDLE fileHandle = CreateFileA(vFilePathName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart <= 0) {
+        CloseHandle(fileHandle);
+        return false;
+    }
+    HANDLE mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mappingHandle == nullptr) {
+        CloseHandle(fileHandle);
+        return false;
+    }
+    void* datas = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (datas == nullptr) {
+        CloseHandle(mappingHandle);
+        CloseHandle(fileHandle);
+        return false;
+    }
+    m_FileHandle = fileHandle;
+    m_MappingHandle = mappingHandle;
+    m_Datas = static_cast<const char*>(datas);
+    m_Size = static_cast<size_t>(fileSize.QuadPart);
+#else
+    const int fd = ::open(vFilePathName.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st = {};
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+    void* datas = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    if (datas == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+    // the file is read once from start to end
+    madvise(datas, static_cast<size_t>(st.st_size), MADV_SEQUENTIAL);
+    m_FileDescriptor = fd;
+    m_Datas = static_cast<const char*>(datas);
+    m_Size = static_cast<size_t>(st.st_size);
+#endif
+    m_Range = LineRange(m_Datas, 0U, m_Size);
+    return true;
+}
+
+void LineReader::close() {
+#ifdef WIN32
+    if (m_Datas != nullptr) {
+        UnmapViewOfFile(m_Datas);
+    }
+    if (m_MappingHandle != nullptr) {
+        CloseHandle(m_MappingHandle);
+        m_MappingHandle = nullptr;
+    }
+    if (m_FileHandle != nullptr) {
+        CloseHandle(m_FileHandle);
+        m_FileHandle = nullptr;
+    }
+#else
+    if (m_Datas != nullptr) {
+        munmap(const_cast<char*>(m_Datas), m_Size);
+    }
+    if (m_FileDescriptor >= 0) {
+        ::close(m_FileDescriptor);
+        m_FileDescriptor = -1;
+    }
+#endif
+    m_Datas = nullptr;
+    m_Size = 0U;
+    m_Range = LineRange();
+}
+
+bool LineReader::isOpened() const {
+    return (m_Datas != nullptr);
+}
+
+const char* LineReader::getDatas() const {
+    return m_Datas;
+}
+
+size_t LineReader::getSize() const {
+    return m_Size;
+}
+
+size_t LineReader::getOffset() const {
+    return m_Range.getOffset();
+}
+
+void LineReader::rewind() {
+    m_Range = LineRange(m_Datas, 0U, m_Size);
+}
+
+int32_t LineReader::countLines() const {
+    return LineRange(m_Datas, 0U, m_Size).countLines();
+}
+
+bool LineReader::nextLine(std::string_view& vOutLine) {
+    return m_Range.nextLine(vOutLine);
+}
+
+std::vector<LineRange> LineReader::split(const size_t& vCount) const {
+    std::vector<LineRange> res;
+    if (m_Datas != nullptr && vCount > 0U) {
+        const size_t chunk_size = std::max<size_t>(1U, m_Size / vCount);
+        size_t begin = 0U;
+        while (begin < m_Size) {
+            size_t end = std::min(begin + chunk_size, m_Size);
+            if (end < m_Size) {
+                // move the end after the next '\n'
+                const char* eol = static_cast<const char*>(memchr(m_Datas + end, '\n', m_Size - end));
+                end = (eol != nullptr) ? static_cast<size_t>(eol - m_Datas) + 1U : m_Size;
+            }
+            res.emplace_back(m_Datas, begin, end);
+            begin = end;
+        }
+    }
+    return res;
+}
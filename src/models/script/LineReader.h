@@ -0,0 +1,87 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <headers/DatasDef.h>
+
+// a range of lines in a mapped file
+// the begin is always at a line start, the end is always after a '\n' or at the end of the file
+class LineRange {
+private:
+    const char* m_Datas = nullptr;
+    size_t m_Offset = 0U;
+    size_t m_End = 0U;
+
+public:
+    LineRange() = default;
+    LineRange(const char* vDatas, const size_t& vBegin, const size_t& vEnd);
+
+    size_t getOffset() const;
+    size_t getEnd() const;
+
+    // count the non empty lines of the remaining range
+    int32_t countLines() const;
+
+    // get the next non empty line, return false at the end of the range
+    bool nextLine(std::string_view& vOutLine);
+};
+
+// read only memory mapping of a source file
+// the lines are given as views into the mapping, so nothing is copied
+// and the memory used stay flat whatever the size of the file
+class LineReader {
+private:
+    const char* m_Datas = nullptr;
+    size_t m_Size = 0U;
+    LineRange m_Range;
+#ifdef WIN32
+    void* m_FileHandle = nullptr;
+    void* m_MappingHandle = nullptr;
+#else
+    int m_FileDescriptor = -1;
+#endif
+
+public:
+    // map the file, return false if the file cant be mapped or is empty
+    bool open(const SourceFilePathName& vFilePathName);
+    void close();
+    bool isOpened() const;
+
+    const char* getDatas() const;
+    size_t getSize() const;
+    size_t getOffset() const;
+    void rewind();
+
+    // count the non empty lines of the file
+    int32_t countLines() const;
+
+    // get the next non empty line, return false at the end of the file
+    bool nextLine(std::string_view& vOutLine);
+
+    // split the file in vCount ranges (or less), cut only at line ends
+    std::vector<LineRange> split(const size_t& vCount) const;
+
+public:
+    LineReader() = default;
+    LineReader(const LineReader&) = delete;
+    LineReader& operator=(const LineReader&) = delete;
+    ~LineReader();
+};
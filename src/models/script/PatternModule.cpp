@@ -0,0 +1,414 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "PatternModule.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <fstream>
+
+#include <ezlibs/ezLog.hpp>
+
+static std::string_view trim(const std::string_view& vStr) {
+    const auto first = vStr.find_first_not_of(" \t\r");
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    const auto last = vStr.find_last_not_of(" \t\r");
+    return vStr.substr(first, last - first + 1U);
+}
+
+// strtod need a null terminated string, the numbers in logs are short
+static bool parseNumber(const std::string_view& vStr, double& vOutNumber) {
+    char buffer[64];
+    const auto str = trim(vStr);
+    if (str.empty() || str.size() >= sizeof(buffer)) {
+        return false;
+    }
+    memcpy(buffer, str.data(), str.size());
+    buffer[str.size()] = '\0';
+    char* end = nullptr;
+    vOutNumber = strtod(buffer, &end);
+    return (end != buffer);
+}
+
+Ltg::ScriptingModulePtr PatternModule::create() {
+    auto res = std::make_shared<PatternModule>();
+    if (!res->init()) {
+        res.reset();
+    }
+    return res;
+}
+
+bool PatternModule::init(Ltg::PluginBridge* /*vBridgePtr*/) {
+    return true;
+}
+
+void PatternModule::unit() {}
+
+bool PatternModule::load(Ltg::IDatasModelWeak vDatasModel) {
+    m_datasModel = vDatasModel;
+    m_ticks.reserve(4096U);
+    return !m_datasModel.expired();
+}
+
+void PatternModule::unload() {
+    m_rules.clear();
+    m_signalHandles.clear();
+    m_ticks.clear();
+    m_datasModel.reset();
+}
+
+bool PatternModule::compileScript(const Ltg::ScriptFilePathName& vFilePathName, Ltg::ErrorContainer& vOutErrors) {
+    m_rules.clear();
+    std::ifstream file(vFilePathName);
+    if (!file.is_open()) {
+        LogVarLightError("Patterns: fail to open the rules file %s", vFilePathName.c_str());
+        return false;
+    }
+    bool res = true;
+    size_t lineNumber = 0U;
+    std::string line;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        const auto row = trim(line);
+        if (row.empty() || row.front() == '#') {
+            continue;
+        }
+        const auto equalPos = row.find('=');
+        if (equalPos == std::string_view::npos) {
+            LogVarLightError("Patterns: line %u, the syntax is key = value", (uint32_t)lineNumber);
+            vOutErrors.push_back({vFilePathName, lineNumber, 0U});
+            res = false;
+            continue;
+        }
+        const auto key = std::string(trim(row.substr(0U, equalPos)));
+        auto value = std::string(trim(row.substr(equalPos + 1U)));
+        if (key != "rule") {
+            // the comments are not allowed in the rule pattern
+            const auto commentPos = value.find('#');
+            if (commentPos != std::string::npos) {
+                value = std::string(trim(std::string_view(value).substr(0U, commentPos)));
+            }
+        }
+        if (key == "rule") {
+            Rule rule;
+            if (m_parseRule(value, rule)) {
+                m_rules.push_back(rule);
+            } else {
+                LogVarLightError("Patterns: line %u, the rule \"%s\" is invalid", (uint32_t)lineNumber, value.c_str());
+                vOutErrors.push_back({vFilePathName, lineNumber, 0U});
+                res = false;
+            }
+        } else if (m_rules.empty()) {
+            LogVarLightError("Patterns: line %u, the key \"%s\" is not after a rule", (uint32_t)lineNumber, key.c_str());
+            vOutErrors.push_back({vFilePathName, lineNumber, 0U});
+            res = false;
+        } else {
+            auto& rule = m_rules.back();
+            if (key == "kind") {
+                if (value == "value") {
+                    rule.kind = RuleKind::VALUE;
+                } else if (value == "status") {
+                    rule.kind = RuleKind::STATUS;
+                } else if (value == "start_zone") {
+                    rule.kind = RuleKind::START_ZONE;
+                } else if (value == "end_zone") {
+                    rule.kind = RuleKind::END_ZONE;
+                } else if (value == "tag") {
+                    rule.kind = RuleKind::TAG;
+                } else {
+                    LogVarLightError("Patterns: line %u, the kind \"%s\" is unknown", (uint32_t)lineNumber, value.c_str());
+                    vOutErrors.push_back({vFilePathName, lineNumber, 0U});
+                    res = false;
+                }
+            } else if (key == "time") {
+                if (value == "epoch") {
+                    rule.timeFormat = TimeFormat::EPOCH;
+                } else if (value == "epoch_ms") {
+                    rule.timeFormat = TimeFormat::EPOCH_MS;
+                } else if (value == "datetime") {
+                    rule.timeFormat = TimeFormat::DATETIME;
+                } else {
+                    LogVarLightError("Patterns: line %u, the time format \"%s\" is unknown", (uint32_t)lineNumber, value.c_str());
+                    vOutErrors.push_back({vFilePathName, lineNumber, 0U});
+                    res = false;
+                }
+            } else if (key == "hour_offset") {
+                parseNumber(value, rule.hourOffset);
+            } else if (key == "category") {
+                rule.category = value;
+            } else if (key == "name") {
+                rule.name = value;
+            } else if (key == "color") {
+                std::istringstream stream(value);
+                stream >> rule.color[0] >> rule.color[1] >> rule.color[2] >> rule.color[3];
+            } else {
+                LogVarLightError("Patterns: line %u, the key \"%s\" is unknown", (uint32_t)lineNumber, key.c_str());
+                vOutErrors.push_back({vFilePathName, lineNumber, 0U});
+                res = false;
+            }
+        }
+    }
+    if (m_rules.empty()) {
+        LogVarLightError("Patterns: no rules in %s", vFilePathName.c_str());
+        res = false;
+    }
+    return res;
+}
+
+bool PatternModule::callScriptStart(Ltg::ErrorContainer& /*vOutErrors*/) {
+    // the signals registry of the database writer is cleared at each analyse
+    m_signalHandles.clear();
+    for (auto& rule : m_rules) {
+        rule.handle = -1;
+    }
+    return true;
+}
+
+bool PatternModule::callScriptExec(const Ltg::ScriptingDatas& vOutDatas, Ltg::ErrorContainer& /*vErrors*/) {
+    auto datasModelPtr = m_datasModel.lock();
+    if (datasModelPtr == nullptr) {
+        return false;
+    }
+    m_execRow(datasModelPtr, vOutDatas.buffer);
+    m_flushTicks(datasModelPtr);
+    return true;
+}
+
+bool PatternModule::callScriptExecBatch(const Ltg::ScriptingDatasBatch& vDatas, Ltg::ErrorContainer& /*vErrors*/) {
+    auto datasModelPtr = m_datasModel.lock();
+    if (datasModelPtr == nullptr) {
+        return false;
+    }
+    m_rowIndex = vDatas.firstRowIndex;
+    for (size_t idx = 0U; idx < vDatas.count; ++idx, ++m_rowIndex) {
+        m_execRow(datasModelPtr, vDatas.rows[idx]);
+    }
+    m_flushTicks(datasModelPtr);
+    return true;
+}
+
+bool PatternModule::callScriptEnd(Ltg::ErrorContainer& /*vOutErrors*/) {
+    auto datasModelPtr = m_datasModel.lock();
+    if (datasModelPtr != nullptr) {
+        m_flushTicks(datasModelPtr);
+    }
+    return true;
+}
+
+void PatternModule::setRowIndex(int32_t vRowIndex) {
+    m_rowIndex = vRowIndex;
+}
+
+void PatternModule::setRowCount(int32_t vRowCount) {
+    m_rowCount = vRowCount;
+}
+
+bool PatternModule::isParallelSafe() const {
+    return true;
+}
+
+bool PatternModule::m_parseRule(const std::string& vPattern, Rule& vOutRule) {
+    static const std::pair<const char*, CaptureField> s_captures[] = {
+        {"{}", CaptureField::IGNORED},
+        {"{category}", CaptureField::CATEGORY},
+        {"{name}", CaptureField::NAME},
+        {"{epoch}", CaptureField::EPOCH},
+        {"{value}", CaptureField::VALUE},
+        {"{desc}", CaptureField::DESC},
+    };
+    vOutRule.segments.clear();
+    Segment segment;
+    size_t pos = 0U;
+    while (pos < vPattern.size()) {
+        bool captured = false;
+        if (vPattern[pos] == '{') {
+            for (const auto& capture : s_captures) {
+                const size_t len = strlen(capture.first);
+                if (vPattern.compare(pos, len, capture.first) == 0) {
+                    if (segment.literal.empty() && !vOutRule.segments.empty()) {
+                        return false;  // two consecutive captures can't be separated
+                    }
+                    segment.capture = capture.second;
+                    vOutRule.segments.push_back(segment);
+                    segment = Segment();
+                    pos += len;
+                    captured = true;
+                    break;
+                }
+            }
+        }
+        if (!captured) {
+            segment.literal += vPattern[pos++];
+        }
+    }
+    vOutRule.segments.push_back(segment);  // the trailing literal, can be empty
+    return !vPattern.empty();
+}
+
+bool PatternModule::m_matchRule(const Rule& vRule, const std::string_view& vRow) {
+    const auto& firstLiteral = vRule.segments.front().literal;
+    if (firstLiteral.empty()) {
+        return m_matchRuleAt(vRule, vRow, 0U);
+    }
+    // like string.match, the first literal can be anywhere in the row, so each occurence is tried
+    for (size_t start = vRow.find(firstLiteral); start != std::string_view::npos; start = vRow.find(firstLiteral, start + 1U)) {
+        if (m_matchRuleAt(vRule, vRow, start)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PatternModule::m_matchRuleAt(const Rule& vRule, const std::string_view& vRow, const size_t& vStartPos) {
+    m_captures.fill({});
+    size_t pos = vStartPos;
+    const size_t segmentsCount = vRule.segments.size();
+    for (size_t idx = 0U; idx < segmentsCount; ++idx) {
+        const auto& segment = vRule.segments[idx];
+        if (!segment.literal.empty()) {
+            if (vRow.compare(pos, segment.literal.size(), segment.literal) != 0) {
+                return false;  // the previous capture stopped before its next literal, only the trailing one can fail here
+            }
+            pos += segment.literal.size();
+        }
+        if (segment.capture != CaptureField::NONE) {
+            // the capture end at the next literal or at the end of the row
+            const auto& nextLiteral = vRule.segments[idx + 1U].literal;
+            size_t end = vRow.size();
+            if (!nextLiteral.empty()) {
+                end = vRow.find(nextLiteral, pos);
+                if (end == std::string_view::npos) {
+                    return false;
+                }
+            }
+            if (segment.capture != CaptureField::IGNORED) {
+                m_captures[static_cast<size_t>(segment.capture)] = vRow.substr(pos, end - pos);
+            }
+            pos = end;
+        }
+    }
+    return true;
+}
+
+bool PatternModule::m_parseEpoch(const Rule& vRule, const std::string_view& vStr, double& vOutEpoch) {
+    switch (vRule.timeFormat) {
+        case TimeFormat::EPOCH: {
+            return parseNumber(vStr, vOutEpoch);
+        }
+        case TimeFormat::EPOCH_MS: {
+            if (parseNumber(vStr, vOutEpoch)) {
+                vOutEpoch /= 1000.0;
+                return true;
+            }
+            return false;
+        }
+        case TimeFormat::DATETIME: {
+            return m_epochParser.parse(trim(vStr), vRule.hourOffset, vOutEpoch);
+        }
+        default: break;
+    }
+    return false;
+}
+
+Ltg::SignalHandle PatternModule::m_getSignalHandle(const Ltg::IDatasModelPtr& vDatasModelPtr, Rule& vRule) {
+    const auto& category = m_captures[static_cast<size_t>(CaptureField::CATEGORY)];
+    const auto& name = m_captures[static_cast<size_t>(CaptureField::NAME)];
+    if (category.empty() && name.empty()) {
+        if (vRule.handle < 0) {
+            vRule.handle = vDatasModelPtr->registerSignal(vRule.category, vRule.name);
+        }
+        return vRule.handle;
+    }
+    m_signalKey.clear();
+    m_signalKey.append(category.empty() ? std::string_view(vRule.category) : category);
+    m_signalKey += '\n';
+    m_signalKey.append(name.empty() ? std::string_view(vRule.name) : name);
+    auto it = m_signalHandles.find(m_signalKey);
+    if (it != m_signalHandles.end()) {
+        return it->second;
+    }
+    const auto separatorPos = m_signalKey.find('\n');
+    const auto handle = vDatasModelPtr->registerSignal(m_signalKey.substr(0U, separatorPos), m_signalKey.substr(separatorPos + 1U));
+    m_signalHandles[m_signalKey] = handle;
+    return handle;
+}
+
+void PatternModule::m_execRow(const Ltg::IDatasModelPtr& vDatasModelPtr, const std::string_view& vRow) {
+    for (auto& rule : m_rules) {
+        if (!m_matchRule(rule, vRow)) {
+            continue;
+        }
+        double epoch = 0.0;
+        if (!m_parseEpoch(rule, m_captures[static_cast<size_t>(CaptureField::EPOCH)], epoch)) {
+            continue;  // the next rules can match this row
+        }
+        const auto& desc = m_captures[static_cast<size_t>(CaptureField::DESC)];
+        if (rule.kind == RuleKind::TAG) {
+            const auto& name = m_captures[static_cast<size_t>(CaptureField::NAME)];
+            vDatasModelPtr->addSignalTag(  //
+                epoch,
+                rule.color[0],
+                rule.color[1],
+                rule.color[2],
+                rule.color[3],
+                name.empty() ? rule.name : std::string(name),
+                std::string(desc));
+            return;
+        }
+        if (rule.kind == RuleKind::VALUE) {
+            double value = 0.0;
+            if (!parseNumber(m_captures[static_cast<size_t>(CaptureField::VALUE)], value)) {
+                continue;  // the next rules can match this row
+            }
+            if (desc.empty()) {
+                const auto handle = m_getSignalHandle(vDatasModelPtr, rule);
+                if (handle >= 0) {
+                    m_ticks.push_back({handle, epoch, value});
+                }
+                return;
+            }
+        }
+        const auto& capturedCategory = m_captures[static_cast<size_t>(CaptureField::CATEGORY)];
+        const auto& capturedName = m_captures[static_cast<size_t>(CaptureField::NAME)];
+        const auto category = capturedCategory.empty() ? rule.category : std::string(capturedCategory);
+        const auto name = capturedName.empty() ? rule.name : std::string(capturedName);
+        switch (rule.kind) {
+            case RuleKind::VALUE: {
+                double value = 0.0;
+                parseNumber(m_captures[static_cast<size_t>(CaptureField::VALUE)], value);
+                vDatasModelPtr->addSignalValue(category, name, epoch, value, std::string(desc));
+            } break;
+            case RuleKind::STATUS: vDatasModelPtr->addSignalStatus(category, name, epoch, std::string(desc)); break;
+            case RuleKind::START_ZONE: vDatasModelPtr->addSignalStartZone(category, name, epoch, std::string(desc)); break;
+            case RuleKind::END_ZONE: vDatasModelPtr->addSignalEndZone(category, name, epoch, std::string(desc)); break;
+            default: break;
+        }
+        return;
+    }
+}
+
+void PatternModule::m_flushTicks(const Ltg::IDatasModelPtr& vDatasModelPtr) {
+    if (!m_ticks.empty()) {
+        vDatasModelPtr->addSignalValueTicks(m_ticks.data(), m_ticks.size());
+        m_ticks.clear();
+    }
+}
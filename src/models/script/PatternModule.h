@@ -0,0 +1,105 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+#include <string_view>
+#include <unordered_map>
+#include <apis/LtgPluginApi.h>
+#include <apis/LtgEpochParser.h>
+
+// built-in scripting module, parse the rows with declarative rules, without any script interpreter
+// the rules file (.ltgp) is selected as the script file of the project
+//
+// # a comment
+// rule = <profiler section="{category}" epoch_time="{epoch}" name="{name}" render_time_ms="{value}">
+// kind = value          # value, status, start_zone, end_zone, tag
+// time = epoch          # epoch, epoch_ms, datetime (YYYY-MM-DD HH:MM:SS.ffffff, ffffff in microseconds)
+// hour_offset = 0       # added to the datetime
+// category = render     # used when {category} is not captured
+// name = frame          # used when {name} is not captured
+// color = 1 0 0 1       # color of the tags
+//
+// the captures are {category}, {name}, {epoch}, {value}, {desc} and {} for ignored text
+// a capture end at the first occurence of the next literal text, or at the end of the row
+// the text of a status or of a zone is the {desc} capture
+// the rules are tried in the order of the file, the first matching rule whose epoch and value are parsed is used
+class PatternModule : public Ltg::ScriptingModule {
+public:
+    static constexpr const char* sc_MODULE_NAME = "Patterns";
+
+    enum class RuleKind { VALUE = 0, STATUS, START_ZONE, END_ZONE, TAG };
+    enum class TimeFormat { EPOCH = 0, EPOCH_MS, DATETIME };
+    enum class CaptureField { NONE = 0, IGNORED, CATEGORY, NAME, EPOCH, VALUE, DESC, Count };
+
+    struct Segment {
+        std::string literal;                         // text to find before the capture, can be empty
+        CaptureField capture = CaptureField::NONE;  // capture following the literal, NONE for the last segment
+    };
+
+    struct Rule {
+        std::vector<Segment> segments;
+        RuleKind kind = RuleKind::VALUE;
+        TimeFormat timeFormat = TimeFormat::EPOCH;
+        double hourOffset = 0.0;
+        std::string category;
+        std::string name;
+        std::array<double, 4> color{1.0, 1.0, 1.0, 1.0};
+        Ltg::SignalHandle handle = -1;  // handle of the constant signal, if category and name are not captured
+    };
+
+    static Ltg::ScriptingModulePtr create();
+
+private:
+    Ltg::IDatasModelWeak m_datasModel;
+    std::vector<Rule> m_rules;
+    std::array<std::string_view, static_cast<size_t>(CaptureField::Count)> m_captures;
+    std::unordered_map<std::string, Ltg::SignalHandle> m_signalHandles;  // captured signals
+    std::string m_signalKey;
+    std::vector<Ltg::SignalValueTick> m_ticks;  // values not yet sent to the datas model
+    Ltg::EpochParser m_epochParser;
+    int32_t m_rowIndex = 0;
+    int32_t m_rowCount = 0;
+
+public:
+    bool init(Ltg::PluginBridge* vBridgePtr = nullptr) final;
+    void unit() final;
+
+    bool load(Ltg::IDatasModelWeak vDatasModel) final;
+    void unload() final;
+    bool compileScript(const Ltg::ScriptFilePathName& vFilePathName, Ltg::ErrorContainer& vOutErrors) final;
+    bool callScriptStart(Ltg::ErrorContainer& vOutErrors) final;
+    bool callScriptExec(const Ltg::ScriptingDatas& vOutDatas, Ltg::ErrorContainer& vErrors) final;
+    bool callScriptExecBatch(const Ltg::ScriptingDatasBatch& vDatas, Ltg::ErrorContainer& vErrors) final;
+    bool callScriptEnd(Ltg::ErrorContainer& vOutErrors) final;
+
+    void setRowIndex(int32_t vRowIndex) final;
+    void setRowCount(int32_t vRowCount) final;
+    bool isParallelSafe() const final;  // the rules have no state between rows
+
+private:
+    bool m_parseRule(const std::string& vPattern, Rule& vOutRule);
+    bool m_matchRule(const Rule& vRule, const std::string_view& vRow);
+    bool m_matchRuleAt(const Rule& vRule, const std::string_view& vRow, const size_t& vStartPos);  // the first literal start at vStartPos
+    bool m_parseEpoch(const Rule& vRule, const std::string_view& vStr, double& vOutEpoch);
+    Ltg::SignalHandle m_getSignalHandle(const Ltg::IDatasModelPtr& vDatasModelPtr, Rule& vRule);
+    void m_execRow(const Ltg::IDatasModelPtr& vDatasModelPtr, const std::string_view& vRow);
+    void m_flushTicks(const Ltg::IDatasModelPtr& vDatasModelPtr);
+};
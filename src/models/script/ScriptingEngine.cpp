@@ -24,10 +24,9 @@ limitations under the License.
 
 #include <models/log/LogEngine.h>
 #include <models/graphs/GraphView.h>
-#include <panes/GraphListPane.h>
-#include <panes/LogPaneSecondView.h>
 
 #include <models/database/DataBase.h>
+#include <models/database/DataBaseWriter.h>
 #include <project/ProjectFile.h>
 
 #include <panes/ToolPane.h>
@@ -36,6 +35,10 @@ limitations under the License.
 #include <ezlibs/ezFile.hpp>
 
 #include <systems/PluginManager.h>
+#include <systems/ParallelFor.h>
+
+#include "ScriptingWorker.h"
+#include "PatternModule.h"
 
 using namespace std::chrono;
 
@@ -43,7 +46,6 @@ using namespace std::chrono;
 /// STATIC ////////////////////////////////////////
 ///////////////////////////////////////////////////
 
-static SourceFileID source_file_id = 0;
 static SourceFileWeak source_file_parent;
 
 ///////////////////////////////////////////////////
@@ -69,7 +71,6 @@ void ScriptingEngine::m_run(std::atomic<double>& vProgress, std::atomic<bool>& v
     const int64_t firstTimeMark = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
 
     Ltg::ScriptingModulePtr scriptingPtr = nullptr;
-    Ltg::IDatasModelWeak datasModel;
 
     s_workerThread_Mutex.lock();
 
@@ -82,61 +83,119 @@ void ScriptingEngine::m_run(std::atomic<double>& vProgress, std::atomic<bool>& v
 
     s_workerThread_Mutex.unlock();
 
-    int32_t rowIndex = 0;  // the current line pos read from file
-    int32_t rowCount = 0;  // the current line pos read from file
+    const bool parallelIngestion = ProjectFile::Instance()->m_ParallelIngestion;
 
-    if (!scriptFilePathName.empty()) {
+    if (!scriptFilePathName.empty() && scriptingPtr != nullptr) {
         if (ez::file::isFileExist(scriptFilePathName)) {
-            if (scriptingPtr->load(ScriptingEngine::Instance())) {
-                Ltg::ErrorContainer errorContainer;
-                if (!scriptingPtr->compileScript(scriptFilePathName, errorContainer)) {
-                    LogVarLightError("Fail to compile script \"%s\"", scriptFilePathName.c_str());
-                } else {
-                    LogEngine::Instance()->Clear();
-                    GraphView::Instance()->Clear();
-                    DataBase::Instance()->OpenDBFile(ProjectFile::Instance()->m_ProjectFilePathName);
-                    DataBase::Instance()->ClearDataTables();
-                    for (const auto& sourceFilePathName : sourceFilePathNames) {
-                        if (!sourceFilePathName.empty() && ez::file::isFileExist(sourceFilePathName)) {
-                            const auto fileContent = ez::file::loadFileToString(sourceFilePathName);
-                            if (!fileContent.empty()) {
-                                try {
-                                    source_file_id = DataBase::Instance()->AddSourceFile(sourceFilePathName);
-                                    DataBase::Instance()->BeginTransaction();
-                                    if (scriptingPtr->callScriptStart(errorContainer)) {
-                                        const auto fileLines = ez::str::splitStringToVector(fileContent, '\n');
-                                        rowCount = (int32_t)fileLines.size();
-                                        scriptingPtr->setRowCount(rowCount);
-                                        SetRowCount(rowCount);
-                                        rowIndex = 0U;
-                                        Ltg::ScriptingDatas datas;
-                                        for (const auto& rowContent : fileLines) {
-                                            if (!vWorking) {
-                                                break;
-                                            }
-                                            const int64_t secondTimeMark = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
-                                            vGenerationTime = (double)(secondTimeMark - firstTimeMark) / 1000.0;
-                                            vProgress = (double)rowIndex / (double)rowCount;
-                                            scriptingPtr->setRowIndex(rowIndex);
-                                            SetRowIndex(rowIndex++);
-                                            datas.buffer = rowContent;
-                                            scriptingPtr->callScriptExec(datas, errorContainer);
-                                        }
-                                        scriptingPtr->callScriptEnd(errorContainer);
-                                    }
-                                    DataBase::Instance()->CommitTransaction();
-                                } catch (std::exception& e) {
-                                    LogVarLightError("%s", e.what());
-                                    DataBase::Instance()->RollbackTransaction();
-                                }
+            // one scripting module instance per worker, the first is the selected one
+            std::vector<ScriptingWorkerPtr> workers;
+            auto firstWorkerPtr = ScriptingWorker::create(scriptingPtr, scriptFilePathName);
+            if (firstWorkerPtr != nullptr) {
+                workers.push_back(firstWorkerPtr);
+            }
+            // a parallel safe script can parse many parts of a same file at same time
+            const bool splitFiles = parallelIngestion && firstWorkerPtr != nullptr && firstWorkerPtr->isParallelSafe();
+            size_t workersCount = 1U;
+            if (splitFiles) {
+                workersCount = ParallelFor::GetThreadsCount(std::thread::hardware_concurrency());
+            } else if (parallelIngestion) {
+                workersCount = ParallelFor::GetThreadsCount(sourceFilePathNames.size());
+            }
+            while (!workers.empty() && workers.size() < workersCount) {
+                auto workerPtr = ScriptingWorker::create(m_createScriptingModule(selectedScripting), scriptFilePathName);
+                if (workerPtr == nullptr) {
+                    break;
+                }
+                workers.push_back(workerPtr);
+            }
+            if (!workers.empty()) {
+                LogEngine::Instance()->Clear();
+                GraphView::Instance()->Clear();
+                DataBase::Instance()->OpenDBFile(ProjectFile::Instance()->m_ProjectFilePathName);
+                DataBase::Instance()->BeginIngestionProfile();
+                DataBase::Instance()->ClearDataTables();
+                // the files are mapped and cutted in ranges of lines, one range per task
+                // the source files are registered before the writer thread take the database
+                struct ParseTask {
+                    size_t fileIdx = 0U;
+                    SourceFileID sourceFileID = 0;
+                    LineRange range;
+                    int32_t firstRowIndex = 0;
+                    int32_t rangeRowCount = 0;
+                };
+                std::vector<std::unique_ptr<LineReader>> lineReaders;
+                std::vector<ParseTask> tasks;
+                for (const auto& sourceFilePathName : sourceFilePathNames) {
+                    if (!sourceFilePathName.empty() && ez::file::isFileExist(sourceFilePathName)) {
+                        const auto sourceFileID = DataBase::Instance()->AddSourceFile(sourceFilePathName);
+                        auto lineReaderPtr = std::make_unique<LineReader>();
+                        if (lineReaderPtr->open(sourceFilePathName)) {
+                            const auto ranges = lineReaderPtr->split(splitFiles ? workers.size() * 4U : 1U);
+                            for (const auto& range : ranges) {
+                                ParseTask task;
+                                task.fileIdx = lineReaders.size();
+                                task.sourceFileID = sourceFileID;
+                                task.range = range;
+                                tasks.push_back(task);
                             }
+                            lineReaders.push_back(std::move(lineReaderPtr));
                         }
                     }
-                    LogEngine::Instance()->Finalize();  // retrieve datas from database
-                    DataBase::Instance()->CloseDBFile();
                 }
-                scriptingPtr->unload();
+                ParallelFor::Run(tasks.size(), workers.size(), [&tasks](size_t vTaskIdx, size_t /*vThreadIdx*/) {
+                    auto& task = tasks.at(vTaskIdx);
+                    task.rangeRowCount = task.range.countLines();
+                });
+                // the row index of the first line of each range, so the script get the row index in the file
+                std::vector<int32_t> fileRowCounts(lineReaders.size(), 0);
+                for (auto& task : tasks) {
+                    task.firstRowIndex = fileRowCounts.at(task.fileIdx);
+                    fileRowCounts.at(task.fileIdx) += task.rangeRowCount;
+                }
+                DataBaseWriter::Instance()->Start();
+                std::atomic<size_t> parsedTasksCount(0U);
+                ParallelFor::Run(
+                    tasks.size(),
+                    workers.size(),
+                    [&](size_t vTaskIdx, size_t vThreadIdx) {
+                        if (vWorking) {
+                            const auto& task = tasks.at(vTaskIdx);
+                            workers.at(vThreadIdx)->parseRange(  //
+                                task.range,
+                                task.sourceFileID,
+                                task.firstRowIndex,
+                                task.rangeRowCount,
+                                fileRowCounts.at(task.fileIdx),
+                                vWorking);
+                        }
+                        ++parsedTasksCount;
+                    },
+                    [&]() {
+                        // the progress is the mean of the tasks progress
+                        double progress = (double)parsedTasksCount;
+                        for (const auto& workerPtr : workers) {
+                            const auto workerProgress = workerPtr->getProgress();
+                            if (workerProgress < 1.0) {
+                                progress += workerProgress;
+                            }
+                        }
+                        vProgress = progress / (double)tasks.size();
+                        const int64_t secondTimeMark = duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+                        vGenerationTime = (double)(secondTimeMark - firstTimeMark) / 1000.0;
+                    });
+                DataBaseWriter::Instance()->Stop();  // wait for the last records to be written
+                LogVarInfo("Files parsed and written in database in %.3f s (%u records)",
+                           (double)vGenerationTime,
+                           static_cast<uint32_t>(DataBaseWriter::Instance()->GetWrittenRecordsCount()));
+                if (DataBaseWriter::Instance()->GetLostRecordsCount() > 0U) {
+                    LogVarError("%u records are not written in database", static_cast<uint32_t>(DataBaseWriter::Instance()->GetLostRecordsCount()));
+                }
+                DataBase::Instance()->EndIngestionProfile();
+                DataBase::Instance()->SetReadProfile();
+                LogEngine::Instance()->Finalize();  // retrieve datas from database
+                DataBase::Instance()->CloseDBFile();
             }
+            workers.clear();  // will unload the modules
         }
     }
 
@@ -193,26 +252,6 @@ std::string ScriptingEngine::GetFunctionForEndFile() const {
     return m_scriptFuncToCallEndFile;
 }
 
-void ScriptingEngine::SetRowIndex(const int32_t& vRowID) {
-    std::lock_guard<std::mutex> guard(s_workerThread_Mutex);
-    m_scriptRowIndex = vRowID;
-}
-
-int32_t ScriptingEngine::GetRowIndex() const {
-    std::lock_guard<std::mutex> guard(s_workerThread_Mutex);
-    return m_scriptRowIndex;
-}
-
-void ScriptingEngine::SetRowCount(const int32_t& vRowCount) {
-    std::lock_guard<std::mutex> guard(s_workerThread_Mutex);
-    m_scriptRowCount = vRowCount;
-}
-
-int32_t ScriptingEngine::GetRowCount() const {
-    std::lock_guard<std::mutex> guard(s_workerThread_Mutex);
-    return m_scriptRowCount;
-}
-
 void ScriptingEngine::SetScriptFilePathName(const SourceFilePathName& vFilePathName) {
     m_scriptFilePathName = vFilePathName;
 }
@@ -281,10 +320,7 @@ bool ScriptingEngine::FinishIfRequired() {
     if (IsJoinable()) {
         if (!ScriptingEngine::s_working) {
             Join();
-            LogPane::Instance()->Clear();
-            LogPaneSecondView::Instance()->Clear();
-            GraphListPane::Instance()->UpdateDB();
-            ToolPane::Instance()->UpdateTree();
+            LogEngine::Instance()->FinalizeViews();
             LogEngine::Instance()->PrepareAfterLoad();
             return true;
         }
@@ -305,77 +341,6 @@ bool ScriptingEngine::isValidScriptingSelected() const {
     return (!m_SelectedScriptingModule.expired());
 }
 
-///////////////////////////////////////////////////////
-//// SCRIPT LANG //////////////////////////////////////
-///////////////////////////////////////////////////////
-
-void ScriptingEngine::addSignalTag(double vEpoch, double r, double g, double b, double a, const std::string& vName, const std::string& vHelp) {
-    if (vName.empty()) {
-        LogVarLightError("%s", "Lua code error : the name is empty");
-    } else {
-        auto color = ImVec4(  //
-            static_cast<float>(r),
-            static_cast<float>(g),
-            static_cast<float>(b),
-            static_cast<float>(a));
-        DataBase::Instance()->AddSignalTag(vEpoch, color, vName, vHelp);
-    }
-}
-
-void ScriptingEngine::addSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStatus) {
-    if (vCategory.empty() || vName.empty()) {
-        if (vCategory.empty()) {
-            LogVarLightError("%s", "Lua code error : the category passed to addSignalStatus is empty");
-        }
-        if (vName.empty()) {
-            LogVarLightError("%s", "Lua code error : the name passed to addSignalStatus is empty");
-        }
-        return;
-    }
-    DataBase::Instance()->AddSignalStatus(source_file_id, vCategory, vName, vEpoch, vStatus, "");
-}
-
-void ScriptingEngine::addSignalValue(const std::string& vCategory, const std::string& vName, double vEpoch, double vValue, const std::string& vDesc) {
-    if (vCategory.empty() || vName.empty()) {
-        if (vCategory.empty()) {
-            LogVarLightError("Lua code error : the category passed to addSignalValue(%s,%s,%f,%f,%s) is empty", //
-                vCategory.c_str(), vName.c_str(), vEpoch, vValue, vDesc.c_str());
-        }
-        if (vName.empty()) {
-            LogVarLightError("Lua code error : the name passed to addSignalValue(%s,%s,%f,%f,%s) is empty", //
-                vCategory.c_str(), vName.c_str(), vEpoch, vValue, vDesc.c_str());
-        }
-        return;
-    }
-    DataBase::Instance()->AddSignalTick(source_file_id, vCategory, vName, vEpoch, vValue, vDesc);
-}
-
-void ScriptingEngine::addSignalStartZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStartMsg) {
-    if (vCategory.empty() || vName.empty()) {
-        if (vCategory.empty()) {
-            LogVarLightError("%s", "Lua code error : the category passed to addSignalStartZone is empty");
-        }
-        if (vName.empty()) {
-            LogVarLightError("%s", "Lua code error : the name passed to addSignalStartZone is empty");
-        }
-        return;
-    }
-    DataBase::Instance()->AddSignalStatus(source_file_id, vCategory, vName, vEpoch, vStartMsg, LogEngine::sc_START_ZONE);
-}
-
-void ScriptingEngine::addSignalEndZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vEndMsg) {
-    if (vCategory.empty() || vName.empty()) {
-        if (vCategory.empty()) {
-            LogVarLightError("%s", "Lua code error : the category passed to addSignalEndZone is empty");
-        }
-        if (vName.empty()) {
-            LogVarLightError("%s", "Lua code error : the name passed to addSignalEndZone is empty");
-        }
-        return;
-    }
-    DataBase::Instance()->AddSignalStatus(source_file_id, vCategory, vName, vEpoch, vEndMsg, LogEngine::sc_END_ZONE);
-}
-
 ///////////////////////////////////////////////////////
 //// CONFIGURATION ////////////////////////////////////
 ///////////////////////////////////////////////////////
@@ -404,10 +369,16 @@ bool ScriptingEngine::setFromXmlNodes(const ez::xml::Node& vNode, const ez::xml:
 void ScriptingEngine::m_fetchScriptingModules() {
     m_scriptingModuleCombo.clear();
     m_scriptingModuleCombo.getArrayRef().push_back("None");
+    // the built-in modules, before the plugins ones
+    auto patternModulePtr = PatternModule::create();
+    if (patternModulePtr != nullptr) {
+        m_scriptingModules[PatternModule::sc_MODULE_NAME] = patternModulePtr;
+        m_scriptingModuleCombo.getArrayRef().push_back(PatternModule::sc_MODULE_NAME);
+    }
     auto modules = PluginManager::Instance()->getPluginModulesInfos();
     for (const auto& mod : modules) {
         if (mod.type == Ltg::PluginModuleType::SCRIPTING) {
-            auto ptr = std::dynamic_pointer_cast<Ltg::ScriptingModule>(PluginManager::Instance()->createPluginModule(mod.label));
+            auto ptr = m_createScriptingModule(mod.label);
             if (ptr != nullptr) {
                 m_scriptingModules[mod.label] = ptr;
                 m_scriptingModuleCombo.getArrayRef().push_back(mod.label);
@@ -416,6 +387,13 @@ void ScriptingEngine::m_fetchScriptingModules() {
     }
 }
 
+Ltg::ScriptingModulePtr ScriptingEngine::m_createScriptingModule(const Ltg::ScriptingModuleName& vName) const {
+    if (vName == PatternModule::sc_MODULE_NAME) {
+        return PatternModule::create();
+    }
+    return std::dynamic_pointer_cast<Ltg::ScriptingModule>(PluginManager::Instance()->createPluginModule(vName));
+}
+
 void ScriptingEngine::m_selectScriptingModule(const Ltg::ScriptingModuleName& vName) {
     if (m_scriptingModules.find(vName) != m_scriptingModules.end()) {
         m_SelectedScriptingModule = m_scriptingModules.at(vName);
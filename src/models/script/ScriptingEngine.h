@@ -27,7 +27,7 @@ limitations under the License.
 #include <headers/DatasDef.h>
 #include <apis/LtgPluginApi.h>
 
-class ScriptingEngine : public Ltg::IDatasModel, public ez::xml::Config {
+class ScriptingEngine : public ez::xml::Config {
 public:
     static std::mutex s_workerThread_Mutex;
     static std::atomic<bool> s_working;
@@ -39,8 +39,6 @@ private:                                       // script objects
     std::string m_rowBufferContent;            // content of the buffer row
     std::string m_scriptFuncToCallForEachRow;  // the function to call for each lines
     std::string m_scriptFuncToCallEndFile;     // the fucntion to call for the end of the file
-    int32_t m_scriptRowIndex = 0;              // the current row pos read from file
-    int32_t m_scriptRowCount = 0;              // the row count read from file
 
 private:  // Misc
     SourceFilePathName m_scriptFilePathName;
@@ -68,12 +66,6 @@ public:
     void SetFunctionForEndFile(const std::string& vName);
     std::string GetFunctionForEndFile() const;
 
-    void SetRowIndex(const int32_t& vRowID);
-    int32_t GetRowIndex() const;
-
-    void SetRowCount(const int32_t& vRowCount);
-    int32_t GetRowCount() const;
-
     void SetScriptFilePathName(const SourceFilePathName& vFilePathName);
 
     void AddSourceFilePathName(const SourceFilePathName& vFilePathName);
@@ -101,16 +93,10 @@ public:
     bool drawMenu();
     bool isValidScriptingSelected() const;
 
-    // interface with script languagesn so must be mutex protected
-    void addSignalTag(double vEpoch, double r, double g, double b, double a, const std::string& vName, const std::string& vHelp) final;
-    void addSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStatus) final;
-    void addSignalValue(const std::string& vCategory, const std::string& vName, double vEpoch, double vValue, const std::string& vDesc) final;
-    void addSignalStartZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStartMsg) final;
-    void addSignalEndZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vEndMsg) final;
-
 private:
     void m_run(std::atomic<double>& vProgress, std::atomic<bool>& vWorking, std::atomic<double>& vGenerationTime);
     void m_fetchScriptingModules();
+    Ltg::ScriptingModulePtr m_createScriptingModule(const Ltg::ScriptingModuleName& vName) const;
     void m_selectScriptingModule(const Ltg::ScriptingModuleName& vName);
 
 public:  // configuration
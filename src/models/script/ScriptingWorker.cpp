@@ -0,0 +1,278 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "ScriptingWorker.h"
+
+#include <models/log/LogEngine.h>
+
+ScriptingWorkerPtr ScriptingWorker::create(const Ltg::ScriptingModulePtr& vScriptingModulePtr, const Ltg::ScriptFilePathName& vScriptFilePathName) {
+    auto res = std::make_shared<ScriptingWorker>();
+    if (!res->m_init(vScriptingModulePtr, vScriptFilePathName)) {
+        res.reset();
+    }
+    return res;
+}
+
+ScriptingWorker::~ScriptingWorker() {
+    if (m_scriptingModulePtr != nullptr) {
+        m_scriptingModulePtr->unload();
+    }
+}
+
+bool ScriptingWorker::m_init(const Ltg::ScriptingModulePtr& vScriptingModulePtr, const Ltg::ScriptFilePathName& vScriptFilePathName) {
+    if (vScriptingModulePtr == nullptr) {
+        return false;
+    }
+    m_scriptingModulePtr = vScriptingModulePtr;
+    if (m_scriptingModulePtr->load(shared_from_this())) {
+        Ltg::ErrorContainer errorContainer;
+        if (m_scriptingModulePtr->compileScript(vScriptFilePathName, errorContainer)) {
+            m_pendingRecords.reserve(DataBaseWriter::sc_BATCH_SIZE);
+            return true;
+        }
+        LogVarLightError("Fail to compile script \"%s\"", vScriptFilePathName.c_str());
+    }
+    return false;
+}
+
+void ScriptingWorker::parseRange(LineRange vRange,
+                                 const SourceFileID& vSourceFileID,
+                                 const int32_t& vFirstRowIndex,
+                                 const int32_t& vRangeRowCount,
+                                 const int32_t& vFileRowCount,
+                                 std::atomic<bool>& vWorking) {
+    m_progress = 0.0;
+    try {
+        m_sourceFileID = vSourceFileID;
+        Ltg::ErrorContainer errorContainer;
+        if (m_scriptingModulePtr->callScriptStart(errorContainer)) {
+            m_scriptingModulePtr->setRowCount(vFileRowCount);
+            // the rows are given to the script by batchs
+            std::vector<std::string_view> rows;
+            rows.reserve(sc_ROWS_BATCH_SIZE);
+            Ltg::ScriptingDatasBatch datas;
+            datas.firstRowIndex = vFirstRowIndex;
+            std::string_view row;
+            bool endOfRange = false;
+            while (!endOfRange && vWorking) {
+                rows.clear();
+                while (rows.size() < sc_ROWS_BATCH_SIZE) {
+                    if (!vRange.nextLine(row)) {
+                        endOfRange = true;
+                        break;
+                    }
+                    rows.push_back(row);
+                }
+                if (!rows.empty()) {
+                    datas.rows = rows.data();
+                    datas.count = rows.size();
+                    m_scriptingModulePtr->callScriptExecBatch(datas, errorContainer);
+                    datas.firstRowIndex += static_cast<int32_t>(rows.size());
+                    m_progress = (double)(datas.firstRowIndex - vFirstRowIndex) / (double)vRangeRowCount;
+                }
+            }
+            m_scriptingModulePtr->callScriptEnd(errorContainer);
+        }
+    } catch (std::exception& e) {
+        // the records are committed by batchs, so the ones of the rows before the error are kept
+        LogVarLightError("%s, the records of the rows parsed before the error are kept", e.what());
+    }
+    m_flushRecords();
+    m_progress = 1.0;
+}
+
+bool ScriptingWorker::isParallelSafe() const {
+    return m_scriptingModulePtr->isParallelSafe();
+}
+
+double ScriptingWorker::getProgress() const {
+    return m_progress;
+}
+
+void ScriptingWorker::addSignalTag(double vEpoch, double r, double g, double b, double a, const std::string& vName, const std::string& vHelp) {
+    if (vName.empty()) {
+        LogVarLightError("%s", "Lua code error : the name is empty");
+    } else {
+        DataBaseRecord record;
+        record.type = DataBaseRecordType::TAG;
+        record.epoch = vEpoch;
+        record.color = ImVec4(  //
+            static_cast<float>(r),
+            static_cast<float>(g),
+            static_cast<float>(b),
+            static_cast<float>(a));
+        record.text = vName;
+        record.status = vHelp;
+        m_pushRecord(std::move(record));
+    }
+}
+
+void ScriptingWorker::addSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStatus) {
+    if (vCategory.empty() || vName.empty()) {
+        if (vCategory.empty()) {
+            LogVarLightError("%s", "Lua code error : the category passed to addSignalStatus is empty");
+        }
+        if (vName.empty()) {
+            LogVarLightError("%s", "Lua code error : the name passed to addSignalStatus is empty");
+        }
+        return;
+    }
+    m_addSignalStatus(vCategory, vName, vEpoch, vStatus, {});
+}
+
+void ScriptingWorker::addSignalValue(const std::string& vCategory, const std::string& vName, double vEpoch, double vValue, const std::string& vDesc) {
+    if (vCategory.empty() || vName.empty()) {
+        if (vCategory.empty()) {
+            LogVarLightError("Lua code error : the category passed to addSignalValue(%s,%s,%f,%f,%s) is empty",  //
+                             vCategory.c_str(), vName.c_str(), vEpoch, vValue, vDesc.c_str());
+        }
+        if (vName.empty()) {
+            LogVarLightError("Lua code error : the name passed to addSignalValue(%s,%s,%f,%f,%s) is empty",  //
+                             vCategory.c_str(), vName.c_str(), vEpoch, vValue, vDesc.c_str());
+        }
+        return;
+    }
+    DataBaseRecord record;
+    record.type = DataBaseRecordType::TICK;
+    record.handle = DataBaseWriter::Instance()->RegisterSignal(vCategory, vName);
+    record.source_file_id = m_sourceFileID;
+    record.epoch = vEpoch;
+    record.value = vValue;
+    record.text = vDesc;
+    m_pushRecord(std::move(record));
+}
+
+void ScriptingWorker::addSignalStartZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStartMsg) {
+    if (vCategory.empty() || vName.empty()) {
+        if (vCategory.empty()) {
+            LogVarLightError("%s", "Lua code error : the category passed to addSignalStartZone is empty");
+        }
+        if (vName.empty()) {
+            LogVarLightError("%s", "Lua code error : the name passed to addSignalStartZone is empty");
+        }
+        return;
+    }
+    m_addSignalStatus(vCategory, vName, vEpoch, vStartMsg, LogEngine::sc_START_ZONE);
+}
+
+void ScriptingWorker::addSignalEndZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vEndMsg) {
+    if (vCategory.empty() || vName.empty()) {
+        if (vCategory.empty()) {
+            LogVarLightError("%s", "Lua code error : the category passed to addSignalEndZone is empty");
+        }
+        if (vName.empty()) {
+            LogVarLightError("%s", "Lua code error : the name passed to addSignalEndZone is empty");
+        }
+        return;
+    }
+    m_addSignalStatus(vCategory, vName, vEpoch, vEndMsg, LogEngine::sc_END_ZONE);
+}
+
+Ltg::SignalHandle ScriptingWorker::registerSignal(const std::string& vCategory, const std::string& vName) {
+    if (vCategory.empty() || vName.empty()) {
+        if (vCategory.empty()) {
+            LogVarLightError("%s", "Lua code error : the category passed to registerSignal is empty");
+        }
+        if (vName.empty()) {
+            LogVarLightError("%s", "Lua code error : the name passed to registerSignal is empty");
+        }
+        return -1;
+    }
+    return DataBaseWriter::Instance()->RegisterSignal(vCategory, vName);
+}
+
+void ScriptingWorker::addSignalValue(Ltg::SignalHandle vHandle, double vEpoch, double vValue) {
+    if (vHandle < 0) {
+        LogVarLightError("%s", "Lua code error : the signal handle passed to addSignalValue is invalid");
+        return;
+    }
+    DataBaseRecord record;
+    record.type = DataBaseRecordType::TICK;
+    record.handle = vHandle;
+    record.source_file_id = m_sourceFileID;
+    record.epoch = vEpoch;
+    record.value = vValue;
+    m_pushRecord(std::move(record));
+}
+
+void ScriptingWorker::addSignalValues(Ltg::SignalHandle vHandle, const double* vEpochs, const double* vValues, size_t vCount) {
+    if (vHandle < 0) {
+        LogVarLightError("%s", "Lua code error : the signal handle passed to addSignalValues is invalid");
+        return;
+    }
+    if (vEpochs == nullptr || vValues == nullptr) {
+        return;
+    }
+    DataBaseRecord record;
+    record.type = DataBaseRecordType::TICK;
+    record.handle = vHandle;
+    record.source_file_id = m_sourceFileID;
+    for (size_t idx = 0U; idx < vCount; ++idx) {
+        record.epoch = vEpochs[idx];
+        record.value = vValues[idx];
+        m_pendingRecords.push_back(record);
+        if (m_pendingRecords.size() >= DataBaseWriter::sc_BATCH_SIZE) {
+            m_flushRecords();
+        }
+    }
+}
+
+void ScriptingWorker::addSignalValueTicks(const Ltg::SignalValueTick* vTicks, size_t vCount) {
+    if (vTicks == nullptr) {
+        return;
+    }
+    DataBaseRecord record;
+    record.type = DataBaseRecordType::TICK;
+    record.source_file_id = m_sourceFileID;
+    for (size_t idx = 0U; idx < vCount; ++idx) {
+        const auto& tick = vTicks[idx];
+        if (tick.handle < 0) {
+            continue;
+        }
+        record.handle = tick.handle;
+        record.epoch = tick.epoch;
+        record.value = tick.value;
+        m_pendingRecords.push_back(record);
+        if (m_pendingRecords.size() >= DataBaseWriter::sc_BATCH_SIZE) {
+            m_flushRecords();
+        }
+    }
+}
+
+void ScriptingWorker::m_addSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vString, const std::string& vStatus) {
+    DataBaseRecord record;
+    record.type = DataBaseRecordType::STATUS;
+    record.handle = DataBaseWriter::Instance()->RegisterSignal(vCategory, vName);
+    record.source_file_id = m_sourceFileID;
+    record.epoch = vEpoch;
+    record.text = vString;
+    record.status = vStatus;
+    m_pushRecord(std::move(record));
+}
+
+void ScriptingWorker::m_pushRecord(DataBaseRecord&& vRecord) {
+    m_pendingRecords.push_back(std::move(vRecord));
+    if (m_pendingRecords.size() >= DataBaseWriter::sc_BATCH_SIZE) {
+        m_flushRecords();
+    }
+}
+
+void ScriptingWorker::m_flushRecords() {
+    DataBaseWriter::Instance()->PushBatch(m_pendingRecords);
+}
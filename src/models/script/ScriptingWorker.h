@@ -0,0 +1,89 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+#include <string_view>
+#include <headers/DatasDef.h>
+#include <apis/LtgPluginApi.h>
+#include <models/database/DataBaseWriter.h>
+#include "LineReader.h"
+
+class ScriptingWorker;
+typedef std::shared_ptr<ScriptingWorker> ScriptingWorkerPtr;
+typedef std::weak_ptr<ScriptingWorker> ScriptingWorkerWeak;
+
+// parse source files ranges with its own scripting module instance
+// the datas produced by the script are sent to the DataBaseWriter
+// so many workers can parse in parallel
+class ScriptingWorker : public Ltg::IDatasModel, public std::enable_shared_from_this<ScriptingWorker> {
+public:
+    static constexpr size_t sc_ROWS_BATCH_SIZE = 1024U;  // rows count given to the script at once
+
+    // load the module with this worker as datas model and compile the script
+    // return nullptr if the script cant be compiled
+    static ScriptingWorkerPtr create(const Ltg::ScriptingModulePtr& vScriptingModulePtr, const Ltg::ScriptFilePathName& vScriptFilePathName);
+
+private:
+    Ltg::ScriptingModulePtr m_scriptingModulePtr = nullptr;
+    SourceFileID m_sourceFileID = 0;
+    DataBaseRecords m_pendingRecords;  // records batch not yet pushed to the database writer
+    std::atomic<double> m_progress{0.0};
+
+public:
+    // parse a range of lines of a file, stop if vWorking become false
+    // vFirstRowIndex is the row index of the first line of the range in the file
+    void parseRange(LineRange vRange,
+                    const SourceFileID& vSourceFileID,
+                    const int32_t& vFirstRowIndex,
+                    const int32_t& vRangeRowCount,
+                    const int32_t& vFileRowCount,
+                    std::atomic<bool>& vWorking);
+
+    // true if the script can parse a file splitted in ranges
+    bool isParallelSafe() const;
+
+    // progress of the current file parsing, [0:1]
+    double getProgress() const;
+
+    // interface with script languages
+    void addSignalTag(double vEpoch, double r, double g, double b, double a, const std::string& vName, const std::string& vHelp) final;
+    void addSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStatus) final;
+    void addSignalValue(const std::string& vCategory, const std::string& vName, double vEpoch, double vValue, const std::string& vDesc) final;
+    void addSignalStartZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vStartMsg) final;
+    void addSignalEndZone(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vEndMsg) final;
+    Ltg::SignalHandle registerSignal(const std::string& vCategory, const std::string& vName) final;
+    void addSignalValue(Ltg::SignalHandle vHandle, double vEpoch, double vValue) final;
+    void addSignalValues(Ltg::SignalHandle vHandle, const double* vEpochs, const double* vValues, size_t vCount) final;
+    void addSignalValueTicks(const Ltg::SignalValueTick* vTicks, size_t vCount) final;
+    using Ltg::IDatasModel::addSignalValues;
+
+private:
+    bool m_init(const Ltg::ScriptingModulePtr& vScriptingModulePtr, const Ltg::ScriptFilePathName& vScriptFilePathName);
+    void m_addSignalStatus(const std::string& vCategory, const std::string& vName, double vEpoch, const std::string& vString, const std::string& vStatus);
+    void m_pushRecord(DataBaseRecord&& vRecord);
+    void m_flushRecords();
+
+public:
+    ScriptingWorker() = default;
+    ScriptingWorker(const ScriptingWorker&) = delete;
+    ScriptingWorker& operator=(const ScriptingWorker&) = delete;
+    virtual ~ScriptingWorker();
+};
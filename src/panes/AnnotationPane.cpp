@@ -173,7 +173,7 @@ void AnnotationPane::CheckItem(SignalSeriePtr vSignalSeriePtr) {
     if (ImGui::IsItemHovered() && vSignalSeriePtr) {
         if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
             // tofix : to centralize in a mvc controller
-            LogEngine::Instance()->ShowHideSignal(vSignalSeriePtr->category, vSignalSeriePtr->name);
+            LogEngine::Instance()->ShowHideSignal(vSignalSeriePtr->id);
             ProjectFile::Instance()->SetProjectChange();
             ToolPane::Instance()->UpdateTree();
             GraphListPane::Instance()->UpdateDB();
@@ -95,7 +95,7 @@ void GraphListPane::DisplayItem(const int& vIdx, const SignalSerieWeak& vDatasSe
             ImGui::TableSetColumnIndex(0);
             if (ImGui::Selectable(datas_ptr->category.c_str(), &datas_ptr->show, ImGuiSelectableFlags_SpanAllColumns, ImVec2(0, GRAPHS_HEIGHT))) {
                 ProjectFile::Instance()->SetProjectChange();
-                LogEngine::Instance()->ShowHideSignal(datas_ptr->category, datas_ptr->name, datas_ptr->show);
+                LogEngine::Instance()->ShowHideSignal(datas_ptr->id, datas_ptr->show);
                 if (ProjectFile::Instance()->m_CollapseLogSelection) {
                     LogPane::Instance()->PrepareLog();
                 }
@@ -105,7 +105,7 @@ void GraphListPane::DisplayItem(const int& vIdx, const SignalSerieWeak& vDatasSe
             ImGui::TableSetColumnIndex(1);
             if (ImGui::Selectable(datas_ptr->name.c_str(), &datas_ptr->show, ImGuiSelectableFlags_SpanAllColumns, ImVec2(0, GRAPHS_HEIGHT))) {
                 ProjectFile::Instance()->SetProjectChange();
-                LogEngine::Instance()->ShowHideSignal(datas_ptr->category, datas_ptr->name, datas_ptr->show);
+                LogEngine::Instance()->ShowHideSignal(datas_ptr->id, datas_ptr->show);
                 if (ProjectFile::Instance()->m_CollapseLogSelection) {
                     LogPane::Instance()->PrepareLog();
                 }
@@ -129,26 +129,19 @@ void GraphListPane::DisplayItem(const int& vIdx, const SignalSerieWeak& vDatasSe
                 ImPlot::SetupAxisLimits(ImAxis_Y1, datas_ptr_range_value.x - y_offset, datas_ptr_range_value.y + y_offset, ImPlotCond_Always);
                 if (ImPlot::BeginItem(datas_ptr->name.c_str())) {
                     ImPlot::GetCurrentItem()->Color = col_u32;
-                    auto& datas_ptr_datas_values = datas_ptr->datas_values;
-                    if (datas_ptr_datas_values.size() > 0U) {
+                    const auto& ticks_time = datas_ptr->ticks_time;
+                    const auto& ticks_value = datas_ptr->ticks_value;
+                    if (!ticks_time.empty()) {
                         ImVec2 last_value_pos, value_pos;
-                        auto _data_ptr_0 = datas_ptr_datas_values.at(0U).lock();
-                        if (_data_ptr_0) {
-                            double last_time = _data_ptr_0->time_epoch, current_time;
-                            double current_value = 0.0;
-                            last_value_pos = ImPlot::PlotToPixels(last_time, _data_ptr_0->value);
-                            for (size_t i = 1U; i < datas_ptr_datas_values.size(); ++i) {
-                                auto _data_ptr_i = datas_ptr_datas_values.at(i).lock();
-                                if (_data_ptr_i) {
-                                    current_time = _data_ptr_i->time_epoch;
-                                    current_value = _data_ptr_i->value;
-                                    value_pos = ImPlot::PlotToPixels(current_time, current_value);
-                                    ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
-                                    draw_list->AddLine(last_value_pos, ImVec2(value_pos.x, last_value_pos.y), col_u32, 2.0f);
-                                    draw_list->AddLine(ImVec2(value_pos.x, last_value_pos.y), value_pos, col_u32, 2.0f);
-                                    last_value_pos = value_pos;
-                                }
-                            }
+                        last_value_pos = ImPlot::PlotToPixels(ticks_time[0U], ticks_value[0U]);
+                        for (size_t i = 1U; i < ticks_time.size(); ++i) {
+                            const double current_time = ticks_time[i];
+                            const double current_value = ticks_value[i];
+                            value_pos = ImPlot::PlotToPixels(current_time, current_value);
+                            ImPlot::FitPoint(ImPlotPoint(current_time, current_value));
+                            draw_list->AddLine(last_value_pos, ImVec2(value_pos.x, last_value_pos.y), col_u32, 2.0f);
+                            draw_list->AddLine(ImVec2(value_pos.x, last_value_pos.y), value_pos, col_u32, 2.0f);
+                            last_value_pos = value_pos;
                         }
                     }
 
@@ -274,7 +267,7 @@ void GraphListPane::HideAllGraphs() {
                     _one_at_least = true;
                 }
 
-                LogEngine::Instance()->ShowHideSignal(item_name.second->category, item_name.second->name, false);
+                LogEngine::Instance()->ShowHideSignal(item_name.second->id, false);
             }
         }
     }
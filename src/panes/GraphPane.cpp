@@ -23,6 +23,7 @@ limitations under the License.
 #include <models/graphs/GraphView.h>
 #include <models/graphs/GraphGroup.h>
 #include <models/log/LogEngine.h>
+#include <systems/AllocationCounter.h>
 
 ///////////////////////////////////////////////////////////////////////////////////
 //// OVERRIDES ////////////////////////////////////////////////////////////////////
@@ -51,6 +52,10 @@ bool GraphPane::DrawPanes(const uint32_t& /*vCurrentFrame*/, bool* vOpened, ImGu
             if (ProjectFile::Instance()->IsProjectLoaded()) {
                 if (ImGui::BeginMenuBar()) {
                     GraphView::Instance()->DrawMenuBar();
+#ifdef _DEBUG
+                    // the draw of the graphs must not allocate, except when the hovered tick change
+                    ImGui::Text("Allocations : %u", static_cast<uint32_t>(m_DrawAllocationsCount));
+#endif
                     ImGui::EndMenuBar();
                 }
 
@@ -66,6 +71,9 @@ bool GraphPane::DrawPanes(const uint32_t& /*vCurrentFrame*/, bool* vOpened, ImGu
                         amh.y /= (float)count_graphs;
                     }
 
+#ifdef _DEBUG
+                    const auto allocations_count = AllocationCounter::GetCount();
+#endif
                     // on les affichent
                     if (ImPlot::BeginAlignedPlots("AlignedGroup")) {
                         bool first_graph = true;
@@ -80,6 +88,9 @@ bool GraphPane::DrawPanes(const uint32_t& /*vCurrentFrame*/, bool* vOpened, ImGu
 
                         ImPlot::EndAlignedPlots();
                     }
+#ifdef _DEBUG
+                    m_DrawAllocationsCount = AllocationCounter::GetCount() - allocations_count;
+#endif
                 }
             }
         }
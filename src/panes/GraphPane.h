@@ -26,6 +26,7 @@ class GraphPane : public AbstractPane {
 private:
     bool m_show_hide_x_axis = true;
     bool m_show_hide_y_axis = false;
+    size_t m_DrawAllocationsCount = 0U;  // heap allocations of the last draw of the graphs, counted only in debug
 
 public:
     bool Init() override;
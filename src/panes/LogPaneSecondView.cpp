@@ -76,7 +76,7 @@ void LogPaneSecondView::CheckItem(const SignalTickPtr& vSignalTick) {
         LogEngine::Instance()->SetHoveredTime(vSignalTick->time_epoch);
 
         if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
-            LogEngine::Instance()->ShowHideSignal(vSignalTick->category, vSignalTick->name);
+            LogEngine::Instance()->ShowHideSignal(vSignalTick->signal_id);
             ProjectFile::Instance()->SetProjectChange();
             ToolPane::Instance()->UpdateTree();
             GraphListPane::Instance()->UpdateDB();
@@ -166,7 +166,7 @@ void LogPaneSecondView::goOnNextSelection() {
     for (int32_t idx = m_LogListClipper.DisplayStart + 1; idx < max_idx; ++idx) {
         const auto infos_ptr = m_LogDatas.at(idx).lock();
         if (infos_ptr) {
-            if (LogEngine::Instance()->isSignalShown(infos_ptr->category, infos_ptr->name)) {
+            if (LogEngine::Instance()->isSignalShown(infos_ptr->signal_id)) {
                 ImGui::SetScrollY(ImGui::GetScrollY() + ImGui::GetTextLineHeightWithSpacing() * (idx - m_LogListClipper.DisplayStart));
                 break;
             }
@@ -179,7 +179,7 @@ void LogPaneSecondView::goOnBackSelection() {
     for (int32_t idx = m_LogListClipper.DisplayStart - 1; idx >= 0; --idx) {
         const auto infos_ptr = m_LogDatas.at(idx).lock();
         if (infos_ptr) {
-            if (LogEngine::Instance()->isSignalShown(infos_ptr->category, infos_ptr->name)) {
+            if (LogEngine::Instance()->isSignalShown(infos_ptr->signal_id)) {
                 ImGui::SetScrollY(ImGui::GetScrollY() + ImGui::GetTextLineHeightWithSpacing() * (idx - m_LogListClipper.DisplayStart));
                 break;
             }
@@ -238,7 +238,7 @@ void LogPaneSecondView::DrawTable() {
                 if (infos_ptr) {
                     ImGui::TableNextRow();
 
-                    selected = LogEngine::Instance()->isSignalShown(infos_ptr->category, infos_ptr->name, &color);
+                    selected = LogEngine::Instance()->isSignalShown(infos_ptr->signal_id, &color);
                     if (selected && color) {
                         ImGui::PushStyleColor(ImGuiCol_Header, (ImU32)color);
                         ImGui::PushStyleColor(ImGuiCol_HeaderActive, (ImU32)color);
@@ -269,30 +269,30 @@ void LogPaneSecondView::DrawTable() {
                     }
                     if (ImGui::TableNextColumn())  // date time
                     {
-                        ImGui::Selectable(infos_ptr->time_date_time.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                        ImGui::Selectable(infos_ptr->getDateTime().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                         CheckItem(infos_ptr);
                     }
                     if (ImGui::TableNextColumn())  // category
                     {
-                        ImGui::Selectable(infos_ptr->category.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                        ImGui::Selectable(infos_ptr->getCategory().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                         CheckItem(infos_ptr);
                     }
                     if (ImGui::TableNextColumn())  // name
                     {
-                        ImGui::Selectable(infos_ptr->name.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                        ImGui::Selectable(infos_ptr->getName().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                         CheckItem(infos_ptr);
                     }
                     if (ImGui::TableNextColumn())  // value
                     {
-                        if (infos_ptr->string.empty()) {
+                        if (infos_ptr->string_id == SignalStringPool::sc_EMPTY_ID) {
                             ImGui::Text("%f", infos_ptr->value);
                         } else {
-                            if (infos_ptr->status == LogEngine::sc_START_ZONE) {
-                                ImGui::Text(ICON_FONT_ARROW_RIGHT_THICK " %s", infos_ptr->string.c_str());
-                            } else if (infos_ptr->status == LogEngine::sc_END_ZONE) {
-                                ImGui::Text("%s " ICON_FONT_ARROW_LEFT_THICK, infos_ptr->string.c_str());
+                            if (infos_ptr->status_id == SignalStringPool::sc_START_ZONE_ID) {
+                                ImGui::Text(ICON_FONT_ARROW_RIGHT_THICK " %s", infos_ptr->getString().c_str());
+                            } else if (infos_ptr->status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                ImGui::Text("%s " ICON_FONT_ARROW_LEFT_THICK, infos_ptr->getString().c_str());
                             } else {
-                                ImGui::Text("%s", infos_ptr->string.c_str());
+                                ImGui::Text("%s", infos_ptr->getString().c_str());
                             }
                         }
                         CheckItem(infos_ptr);
@@ -315,7 +315,7 @@ void LogPaneSecondView::DrawTable() {
 }
 
 void LogPaneSecondView::PrepareLog() {
-    if (ScriptingEngine::Instance()->IsJoinable())
+    if (ScriptingEngine::Instance()->IsJoinable() || ProjectFile::Instance()->IsLoading())
         return;
 
     m_LogDatas.clear();
@@ -341,7 +341,7 @@ void LogPaneSecondView::PrepareLog() {
                 }
             }
 
-            auto selected = LogEngine::Instance()->isSignalShown(infos_ptr->category, infos_ptr->name);
+            auto selected = LogEngine::Instance()->isSignalShown(infos_ptr->signal_id);
             if (_collapseSelection && !selected)
                 continue;
 
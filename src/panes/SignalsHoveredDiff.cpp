@@ -68,7 +68,7 @@ bool SignalsHoveredDiff::DrawPanes(const uint32_t& /*vCurrentFrame*/, bool* vOpe
 void SignalsHoveredDiff::CheckItem(const SignalTickPtr& vSignalTick) {
     if (vSignalTick && ImGui::IsItemHovered()) {
         if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
-            LogEngine::Instance()->ShowHideSignal(vSignalTick->category, vSignalTick->name);
+            LogEngine::Instance()->ShowHideSignal(vSignalTick->signal_id);
             LogEngine::Instance()->UpdateVisibleSignalsColoring();
             ProjectFile::Instance()->SetProjectChange();
         }
@@ -141,7 +141,7 @@ void SignalsHoveredDiff::DrawTable() {
                         if (diff_first_mark_ptr && diff_second_mark_ptr) {
                             ImGui::TableNextRow();
 
-                            selected = LogEngine::Instance()->isSignalShown(diff_first_mark_ptr->category, diff_first_mark_ptr->name, &color);
+                            selected = LogEngine::Instance()->isSignalShown(diff_first_mark_ptr->signal_id, &color);
                             if (selected && color) {
                                 ImGui::PushStyleColor(ImGuiCol_Header, (ImU32)color);
                                 ImGui::PushStyleColor(ImGuiCol_HeaderActive, (ImU32)color);
@@ -157,40 +157,40 @@ void SignalsHoveredDiff::DrawTable() {
 
                             if (ImGui::TableNextColumn())  // category
                             {
-                                ImGui::Selectable(diff_first_mark_ptr->category.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                                ImGui::Selectable(diff_first_mark_ptr->getCategory().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                                 CheckItem(diff_first_mark_ptr);
                             }
                             if (ImGui::TableNextColumn())  // name
                             {
-                                ImGui::Selectable(diff_first_mark_ptr->name.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                                ImGui::Selectable(diff_first_mark_ptr->getName().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                                 CheckItem(diff_first_mark_ptr);
                             }
                             if (ImGui::TableNextColumn())  // first value
                             {
-                                if (diff_first_mark_ptr->string.empty()) {
+                                if (diff_first_mark_ptr->string_id == SignalStringPool::sc_EMPTY_ID) {
                                     ImGui::Text("%f", diff_first_mark_ptr->value);
                                 } else {
-                                    if (diff_first_mark_ptr->status == LogEngine::sc_START_ZONE) {
-                                        ImGui::Text(ICON_FONT_ARROW_RIGHT_THICK " %s", diff_first_mark_ptr->string.c_str());
-                                    } else if (diff_first_mark_ptr->status == LogEngine::sc_END_ZONE) {
-                                        ImGui::Text("%s " ICON_FONT_ARROW_LEFT_THICK, diff_first_mark_ptr->string.c_str());
+                                    if (diff_first_mark_ptr->status_id == SignalStringPool::sc_START_ZONE_ID) {
+                                        ImGui::Text(ICON_FONT_ARROW_RIGHT_THICK " %s", diff_first_mark_ptr->getString().c_str());
+                                    } else if (diff_first_mark_ptr->status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                        ImGui::Text("%s " ICON_FONT_ARROW_LEFT_THICK, diff_first_mark_ptr->getString().c_str());
                                     } else {
-                                        ImGui::Text("%s", diff_first_mark_ptr->string.c_str());
+                                        ImGui::Text("%s", diff_first_mark_ptr->getString().c_str());
                                     }
                                 }
                                 CheckItem(diff_first_mark_ptr);
                             }
                             if (ImGui::TableNextColumn())  // second value
                             {
-                                if (diff_second_mark_ptr->string.empty()) {
+                                if (diff_second_mark_ptr->string_id == SignalStringPool::sc_EMPTY_ID) {
                                     ImGui::Text("%f", diff_second_mark_ptr->value);
                                 } else {
-                                    if (diff_second_mark_ptr->status == LogEngine::sc_START_ZONE) {
-                                        ImGui::Text(ICON_FONT_ARROW_RIGHT_THICK " %s", diff_second_mark_ptr->string.c_str());
-                                    } else if (diff_second_mark_ptr->status == LogEngine::sc_END_ZONE) {
-                                        ImGui::Text(ICON_FONT_ARROW_LEFT_THICK " %s", diff_second_mark_ptr->string.c_str());
+                                    if (diff_second_mark_ptr->status_id == SignalStringPool::sc_START_ZONE_ID) {
+                                        ImGui::Text(ICON_FONT_ARROW_RIGHT_THICK " %s", diff_second_mark_ptr->getString().c_str());
+                                    } else if (diff_second_mark_ptr->status_id == SignalStringPool::sc_END_ZONE_ID) {
+                                        ImGui::Text(ICON_FONT_ARROW_LEFT_THICK " %s", diff_second_mark_ptr->getString().c_str());
                                     } else {
-                                        ImGui::Text("%s", diff_second_mark_ptr->string.c_str());
+                                        ImGui::Text("%s", diff_second_mark_ptr->getString().c_str());
                                     }
                                 }
                                 CheckItem(diff_second_mark_ptr);
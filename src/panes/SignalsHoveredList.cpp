@@ -154,7 +154,7 @@ void SignalsHoveredList::DrawTable() {
                         if (infos_ptr) {
                             ImGui::TableNextRow();
 
-                            selected = LogEngine::Instance()->isSignalShown(infos_ptr->category, infos_ptr->name, &color);
+                            selected = LogEngine::Instance()->isSignalShown(infos_ptr->signal_id, &color);
                             if (selected && color) {
                                 ImGui::PushStyleColor(ImGuiCol_Header, (ImU32)color);
                                 ImGui::PushStyleColor(ImGuiCol_HeaderActive, (ImU32)color);
@@ -172,33 +172,33 @@ void SignalsHoveredList::DrawTable() {
                                 ImGui::Selectable(ez::str::toStr("%f", infos_ptr->time_epoch).c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                             }
                             if (ImGui::TableNextColumn()) {  // date time
-                                ImGui::Selectable(infos_ptr->time_date_time.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                                ImGui::Selectable(infos_ptr->getDateTime().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                             }
                             if (ImGui::TableNextColumn()) {  // category
-                                ImGui::Selectable(infos_ptr->category.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                                ImGui::Selectable(infos_ptr->getCategory().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                             }
                             if (ImGui::TableNextColumn()) {  // name
-                                ImGui::Selectable(infos_ptr->name.c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
+                                ImGui::Selectable(infos_ptr->getName().c_str(), &selected, ImGuiSelectableFlags_SpanAllColumns);
                             }
                             if (ImGui::TableNextColumn()) {  // value
                                 // clang-format off
-                                if (infos_ptr->string.empty()) {
+                                if (infos_ptr->string_id == SignalStringPool::sc_EMPTY_ID) {
                                     ImGui::DrawRectOverText(infos_ptr->just_changed, 
                                         updatedRectColor, updatedRectOffset, updatedRectTickness, 
                                         "%f", infos_ptr->value);
                                 } else {
-                                    if (infos_ptr->status == LogEngine::sc_START_ZONE) {
+                                    if (infos_ptr->status_id == SignalStringPool::sc_START_ZONE_ID) {
                                         ImGui::DrawRectOverText(infos_ptr->just_changed, 
                                             updatedRectColor, updatedRectOffset, updatedRectTickness, 
-                                            ICON_FONT_ARROW_RIGHT_THICK " %s", infos_ptr->string.c_str());
-                                    } else if (infos_ptr->status == LogEngine::sc_END_ZONE) {
+                                            ICON_FONT_ARROW_RIGHT_THICK " %s", infos_ptr->getString().c_str());
+                                    } else if (infos_ptr->status_id == SignalStringPool::sc_END_ZONE_ID) {
                                         ImGui::DrawRectOverText(infos_ptr->just_changed, 
                                             updatedRectColor, updatedRectOffset, updatedRectTickness, 
-                                            "%s " ICON_FONT_ARROW_LEFT_THICK, infos_ptr->string.c_str());
+                                            "%s " ICON_FONT_ARROW_LEFT_THICK, infos_ptr->getString().c_str());
                                     } else {
                                         ImGui::DrawRectOverText(infos_ptr->just_changed, 
                                             updatedRectColor, updatedRectOffset, updatedRectTickness, 
-                                            "%s", infos_ptr->string.c_str());
+                                            "%s", infos_ptr->getString().c_str());
                                     }
                                 }
                                 // clang-format on
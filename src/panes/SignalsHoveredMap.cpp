@@ -127,7 +127,7 @@ int SignalsHoveredMap::DrawSignalButton(const SignalTickPtr& vPtr, ImVec2 vGlyph
             ImGui::RenderFrame(bb.Min, bb.Max, colButton, true, rounding);
 
             if (ImGui::IsItemHovered()) {
-                auto date_str = LogEngine::sConvertEpochToDateTimeString(vPtr->time_epoch);
+                const auto& date_str = LogEngine::Instance()->GetDateTimeString(vPtr->time_epoch);
                 ImGui::SetTooltip("%s : %f\ntime : %f\ndate : %s", parent_ptr->name.c_str(), vPtr->value, vPtr->time_epoch, date_str.c_str());
             }
         }
@@ -80,28 +80,21 @@ void SignalsPreview::SetHoveredTime(const SignalEpochTime& vHoveredTime) {
     for (auto& item_cat : LogEngine::Instance()->GetSignalSeries()) {
         for (auto& item_name : item_cat.second) {
             if (item_name.second) {
-                SignalTickPtr last_ptr = nullptr;
-                for (const auto& tick_weak : item_name.second->datas_values) {
-                    auto ptr = tick_weak.lock();
-                    if (last_ptr && vHoveredTime >= last_ptr->time_epoch && ptr && vHoveredTime <= ptr->time_epoch) {
-                        if (idx < count_signals) {
-                            m_PreviewTicks[idx] = last_ptr;
-                            if (ProjectFile::Instance()->m_AutoColorize) {
-                                auto parent_ptr = last_ptr->parent.lock();
-                                if (parent_ptr && parent_ptr->show) {
-                                    parent_ptr->color_u32 = ImGui::GetColorU32(ez::getRainBowColor((int32_t)visible_idx, (int32_t)visible_count));
-                                    parent_ptr->color_v4 = ImGui::ColorConvertU32ToFloat4(parent_ptr->color_u32);
-                                    ++visible_idx;
-                                }
+                const auto tick_idx = item_name.second->findTickIndexAt(vHoveredTime, item_name.second->hover_cursor);
+                if (tick_idx != SignalSerie::sc_NO_TICK) {
+                    if (idx < count_signals) {
+                        m_PreviewTicks[idx] = item_name.second->getTick(tick_idx);
+                        if (ProjectFile::Instance()->m_AutoColorize) {
+                            auto& parent_ptr = item_name.second;
+                            if (parent_ptr->show) {
+                                parent_ptr->color_u32 = ImGui::GetColorU32(ez::getRainBowColor((int32_t)visible_idx, (int32_t)visible_count));
+                                parent_ptr->color_v4 = ImGui::ColorConvertU32ToFloat4(parent_ptr->color_u32);
+                                ++visible_idx;
                             }
-                        } else {
-                            EZ_TOOLS_DEBUG_BREAK;
                         }
-
-                        break;
+                    } else {
+                        EZ_TOOLS_DEBUG_BREAK;
                     }
-
-                    last_ptr = ptr;
                 }
 
                 ++idx;
@@ -177,7 +170,7 @@ int SignalsPreview::DrawSignalButton(SignalTickPtr vPtr, ImVec2 vGlyphSize) {
             ImGui::RenderFrame(bb.Min, bb.Max, colButton, true, rounding);
 
             if (ImGui::IsItemHovered()) {
-                auto date_str = LogEngine::sConvertEpochToDateTimeString(vPtr->time_epoch);
+                const auto& date_str = LogEngine::Instance()->GetDateTimeString(vPtr->time_epoch);
                 ImGui::SetTooltip("%s : %f\ntime : %f\ndate : %s", parent_ptr->name.c_str(), vPtr->value, vPtr->time_epoch, date_str.c_str());
             }
         }
@@ -131,7 +131,7 @@ void ToolPane::DrawTable() {
             config.countSelectionMax = 1;
             config.filePathName = ProjectFile::Instance()->GetScriptFilePathName();
             config.flags = ImGuiFileDialogFlags_Modal;
-            ImGuiFileDialog::Instance()->OpenDialog("OPEN_LUA_SCRIPT_FILE", "Open a Script Script File", ".lua,.*", config);
+            ImGuiFileDialog::Instance()->OpenDialog("OPEN_LUA_SCRIPT_FILE", "Open a Script Script File", ".lua,.ltgp,.*", config);
         }
         if (ImGui::ContrastedButton(ICON_FONT_PENCIL "##ScriptScriptEdit")) {
             ez::file::openFile(ProjectFile::Instance()->GetScriptFilePathName());
@@ -226,8 +226,13 @@ void ToolPane::DrawTable() {
 
     if (ImGui::CollapsingHeader("Analyse")) {
         ScriptingEngine::Instance()->drawMenu();
+        if (ImGui::CheckBoxBoolDefault("Parse source files in parallel", &ProjectFile::Instance()->m_ParallelIngestion, false)) {
+            ProjectFile::Instance()->SetProjectChange();
+        }
         if (ScriptingEngine::Instance()->isValidScriptingSelected()) {
-            if (!ScriptingEngine::Instance()->IsJoinable()) {
+            if (ProjectFile::Instance()->IsLoading()) {
+                ImGui::Text("%s", "The project is loading");
+            } else if (!ScriptingEngine::Instance()->IsJoinable()) {
                 if (ImGui::ContrastedButton("Start Analyse of file(s)", nullptr, nullptr, -1.0f, ImVec2(-1.0f, 0.0f))) {
                     ScriptingEngine::Instance()->Clear();
                     ScriptingEngine::Instance()->SetScriptFilePathName(ProjectFile::Instance()->GetScriptFilePathName());
@@ -254,6 +259,14 @@ void ToolPane::DrawTree() {
 
     ImGui::Header("Signals");
 
+    if (ProjectFile::Instance()->IsLoading()) {
+        if (ImGui::ContrastedButton("Stop Loading##ToolPane_DrawTree", nullptr, nullptr, -1.0f, ImVec2(-1.0f, 0.0f))) {
+            ProjectFile::Instance()->CancelLoad();
+        }
+        auto progress = (float)ProjectFile::s_loadProgress;
+        ImGui::ProgressBar(progress);
+    }
+
     bool _collapse_all = false;
     bool _expand_all = false;
 
@@ -305,7 +318,7 @@ void ToolPane::HideAllGraphs() {
                     _one_at_least = true;
                 }
 
-                LogEngine::Instance()->ShowHideSignal(item_name.second->category, item_name.second->name, false);
+                LogEngine::Instance()->ShowHideSignal(item_name.second->id, false);
             }
         }
     }
@@ -23,6 +23,7 @@
 #include <models/database/DataBase.h>
 #include <models/graphs/GraphView.h>
 #include <models/graphs/GraphGroup.h>
+#include <models/graphs/GraphAnnotationModel.h>
 #include <panes/LogPane.h>
 #include <panes/ToolPane.h>
 #include <panes/LogPaneSecondView.h>
@@ -39,6 +40,12 @@
 
 #include <ezlibs/ezFile.hpp>
 
+#include <chrono>
+
+std::atomic<bool> ProjectFile::s_loading(false);
+std::atomic<double> ProjectFile::s_loadProgress(0.0);
+std::atomic<bool> ProjectFile::s_loadCatalogReady(false);
+
 ProjectFile::ProjectFile() = default;
 
 ProjectFile::ProjectFile(const std::string& vFilePathName) {
@@ -65,6 +72,7 @@ void ProjectFile::Clear() {
 }
 
 void ProjectFile::ClearDatas() {
+    StopLoadThread();
     ScriptingEngine::Instance()->Clear();
     LogEngine::Instance()->Clear();
     GraphView::Instance()->Clear();
@@ -77,6 +85,9 @@ void ProjectFile::ClearDatas() {
     SignalsHoveredDiff::Instance()->Clear();
     SignalsHoveredList::Instance()->Clear();
     SignalsHoveredMap::Instance()->Clear();
+    GraphAnnotationModel::Instance()->Clear();
+    // nothing hold a weak ptr on the cleared ticks and series now
+    LogEngine::Instance()->ReleaseRetiredArenas();
 }
 
 void ProjectFile::New() {
@@ -110,9 +121,12 @@ bool ProjectFile::Load() {
 bool ProjectFile::LoadAs(const std::string& vFilePathName) {
     if (!vFilePathName.empty()) {
         Clear();
+        // the previous load must release its database before the open of the new one
+        StopLoadThread();
         std::string filePathName = ez::file::simplifyFilePath(vFilePathName);
         if (DataBase::Instance()->IsFileASqlite3DB(filePathName)) {
             if (DataBase::Instance()->OpenDBFile(filePathName)) {
+                DataBase::Instance()->SetReadProfile();
                 ClearDatas();
                 auto xml_settings = DataBase::Instance()->GetSettingsXMLDatas();
                 if (LoadConfigString(ez::xml::Node::unEscapeXml(xml_settings), "") || xml_settings.empty()) {
@@ -130,12 +144,8 @@ bool ProjectFile::LoadAs(const std::string& vFilePathName) {
                     LogVarError("The project file %s cant be loaded", filePathName.c_str());
                 }
 
-                LogEngine::Instance()->Finalize();
-                GraphListPane::Instance()->UpdateDB();
-                ToolPane::Instance()->UpdateTree();
-                LogEngine::Instance()->PrepareAfterLoad();
-
-                DataBase::Instance()->CloseDBFile();
+                // the database will be closed by the load thread
+                StartLoadThread();
             }
         }
     }
@@ -143,7 +153,7 @@ bool ProjectFile::LoadAs(const std::string& vFilePathName) {
 }
 
 bool ProjectFile::Save() {
-    if (m_NeverSaved) {
+    if (m_NeverSaved || IsLoading()) {  // the database is used by the load thread
         return false;
     }
 
@@ -173,6 +183,72 @@ bool ProjectFile::SaveAs(const std::string& vFilePathName) {
     return false;
 }
 
+void ProjectFile::StartLoadThread() {
+    StopLoadThread();
+    m_LoadCanceled = false;
+    m_LoadCatalogShown = false;
+    ProjectFile::s_loadProgress = 0.0;
+    ProjectFile::s_loadCatalogReady = false;
+    ProjectFile::s_loading = true;
+    m_LoadThread = std::thread(  //
+        &ProjectFile::m_runLoad,
+        this,
+        std::ref(ProjectFile::s_loadProgress),
+        std::ref(ProjectFile::s_loading),
+        std::ref(ProjectFile::s_loadCatalogReady));
+}
+
+bool ProjectFile::StopLoadThread() {
+    bool res = IsLoading();
+    if (res) {
+        ProjectFile::s_loading = false;
+        m_LoadThread.join();
+    }
+    return res;
+}
+
+void ProjectFile::CancelLoad() {
+    // the thread will be joined by FinishLoadIfRequired
+    ProjectFile::s_loading = false;
+}
+
+bool ProjectFile::IsLoading() {
+    return m_LoadThread.joinable();
+}
+
+bool ProjectFile::FinishLoadIfRequired() {
+    if (IsLoading()) {
+        if (ProjectFile::s_loadCatalogReady && !m_LoadCatalogShown) {
+            // the series are all created, the tree can be shown while the ticks are read
+            ToolPane::Instance()->UpdateTree();
+            m_LoadCatalogShown = true;
+        }
+        if (!ProjectFile::s_loading) {
+            m_LoadThread.join();
+            if (m_LoadCanceled) {
+                LogEngine::Instance()->Clear();
+                LogVarInfo("The loading of the project %s was canceled", m_ProjectFileName.c_str());
+            }
+            LogEngine::Instance()->FinalizeViews();
+            LogEngine::Instance()->PrepareAfterLoad();
+            return true;
+        }
+    }
+    return false;
+}
+
+void ProjectFile::m_runLoad(std::atomic<double>& vProgress, std::atomic<bool>& vWorking, std::atomic<bool>& vCatalogReady) {
+    const auto start_time = std::chrono::steady_clock::now();
+    LogEngine::Instance()->Finalize(vProgress, vWorking, vCatalogReady);
+    DataBase::Instance()->CloseDBFile();
+    if (vWorking) {
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+        LogVarInfo("Project datas loaded in %.3f s", elapsed);
+    }
+    m_LoadCanceled = !vWorking;
+    vWorking = false;
+}
+
 bool ProjectFile::IsProjectLoaded() const {
     return m_IsLoaded;
 }
@@ -279,6 +355,7 @@ ez::xml::Nodes ProjectFile::getXmlNodes(const std::string& /*vUserDatas*/) {
     node.addChild("default_curve_display_thickness").setContent(m_DefaultCurveDisplayThickNess);
     node.addChild("use_predefined_zero_value").setContent(m_UsePredefinedZeroValue);
     node.addChild("predefined_zero_value").setContent(m_PredefinedZeroValue);
+    node.addChild("parallel_ingestion").setContent(m_ParallelIngestion);
     node.addChild("show_variable_signals_in_all_graph_view").setContent(m_ShowVariableSignalsInAllGraphView);
     node.addChild("show_variable_signals_in_graph_view").setContent(m_ShowVariableSignalsInGraphView);
     node.addChild("show_variable_signals_in_hovered_list_view").setContent(m_ShowVariableSignalsInHoveredListView);
@@ -354,6 +431,8 @@ bool ProjectFile::setFromXmlNodes(const ez::xml::Node& vNode, const ez::xml::Nod
             m_UsePredefinedZeroValue = ez::ivariant(strValue).GetB();
         } else if (strName == "predefined_zero_value") {
             m_PredefinedZeroValue = ez::dvariant(strValue).GetD();
+        } else if (strName == "parallel_ingestion") {
+            m_ParallelIngestion = ez::ivariant(strValue).GetB();
         } else if (strName == "show_variable_signals_in_all_graph_view") {
             m_ShowVariableSignalsInAllGraphView = ez::dvariant(strValue).GetB();
         } else if (strName == "show_variable_signals_in_graph_view") {
@@ -16,6 +16,8 @@
 #pragma once
 
 #include <string>
+#include <thread>
+#include <atomic>
 #include <memory>
 #include <unordered_map>
 #include <headers/DatasDef.h>
@@ -33,6 +35,11 @@ struct GraphColor {
 };
 
 class ProjectFile : public Ltg::IProject, public ez::xml::Config {
+public:  // load thread
+    static std::atomic<bool> s_loading;
+    static std::atomic<double> s_loadProgress;
+    static std::atomic<bool> s_loadCatalogReady;
+
 public:  // to save
     GraphColor m_GraphColors;
     bool m_CollapseLogSelection = false;
@@ -60,6 +67,7 @@ public:  // to save
     double m_DefaultCurveDisplayThickNess = 2.0;   // for display a default curve
     bool m_UsePredefinedZeroValue = false;         // use predefined zero value
     double m_PredefinedZeroValue = 0.0;            // the predefined zero value for signals
+    bool m_ParallelIngestion = false;              // parse each source file on its own worker
     SourceFilePathName m_ScriptFilePathName;
     SourceFileName m_ScriptFileName;
     SourceFileContainer m_SourceFilePathNames;
@@ -79,6 +87,9 @@ private:  // dont save
     bool m_IsThereAnyChanges = false;
     bool m_WasJustSaved = false;
     size_t m_WasJustSavedFrameCounter = 0U;  // the state of m_WasJustSaved will be keeped during two frames
+    std::thread m_LoadThread;                // read the datas of the project from the database
+    bool m_LoadCanceled = false;             // set by the load thread, read after the join
+    bool m_LoadCatalogShown = false;         // the signal tree was updated with the catalogue
 
 public:
     ProjectFile();
@@ -94,6 +105,13 @@ public:
     bool Save();
     bool SaveAs(const std::string& vFilePathName);
 
+    // the datas are loaded on a worker thread, the panes are updated by FinishLoadIfRequired
+    void StartLoadThread();
+    bool StopLoadThread();
+    void CancelLoad();
+    bool IsLoading();
+    bool FinishLoadIfRequired();
+
     bool IsProjectLoaded() const override;
     bool IsProjectNeverSaved() const override;
     bool IsThereAnyProjectChanges() const override;
@@ -112,6 +130,9 @@ public:
     bool RemoveFilePathName(const SourceFilePathName& vFilePathName);
     const std::vector<std::pair<SourceFileName, SourceFilePathName>>& GetSourceFilePathNames() const;
 
+private:
+    void m_runLoad(std::atomic<double>& vProgress, std::atomic<bool>& vWorking, std::atomic<bool>& vCatalogReady);
+
 public:
     ez::xml::Nodes getXmlNodes(const std::string& vUserDatas = "") override;
     bool setFromXmlNodes(const ez::xml::Node& vNode, const ez::xml::Node& vParent, const std::string& vUserDatas) override;
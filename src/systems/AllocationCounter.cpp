@@ -0,0 +1,49 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check it.
+// PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+
+/*
+Copyright 2022-2023 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#include "AllocationCounter.h"
+#include <new>
+#include <cstdlib>
+
+// one count per thread, so the load, parse and writer threads are not counted in a draw of the ui thread
+static thread_local size_t s_AllocationsCount = 0U;
+
+#ifdef _DEBUG
+// the array, nothrow and sized forms call these ones
+void* operator new(std::size_t vSize) {
+    ++s_AllocationsCount;
+    void* ptr = std::malloc(vSize > 0U ? vSize : 1U);
+    if (ptr == nullptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete(void* vPtr) noexcept {
+    std::free(vPtr);
+}
+
+void operator delete(void* vPtr, std::size_t /*vSize*/) noexcept {
+    std::free(vPtr);
+}
+#endif
+
+size_t AllocationCounter::GetCount() {
+    return s_AllocationsCount;
+}
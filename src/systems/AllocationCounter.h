@@ -0,0 +1,30 @@
+/*
+Copyright 2022-2023 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <cstddef>
+
+/*
+ count of the heap allocations of the calling thread
+ the global operator new is replaced only in debug (_DEBUG defined), so the count is always 0 in release
+ used for check the frames who must not allocate, like the draw of the graphs
+*/
+
+class AllocationCounter {
+public:
+    static size_t GetCount();  // allocations of the calling thread since its start
+};
@@ -0,0 +1,71 @@
+/*
+Copyright 2022-2024 Stephane Cuillerdier (aka aiekick)
+
+Licensed under the Apache License, Version 2.0 (the "License");
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+*/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+#include <cstdint>
+#include <algorithm>
+#include <functional>
+
+class ParallelFor {
+public:
+    // the count of threads to use for vTasksCount tasks
+    static size_t GetThreadsCount(const size_t& vTasksCount) {
+        const size_t hw = std::max<size_t>(1U, std::thread::hardware_concurrency());
+        return std::max<size_t>(1U, std::min(hw, vTasksCount));
+    }
+
+    // will call vTask(taskIdx, threadIdx) for each task of [0, vTasksCount) on vThreadsCount threads
+    // the tasks are taken in order by the first free thread
+    // vWaitCallback is called regularly by the calling thread until all tasks are done (progress update, etc..)
+    static void Run(const size_t& vTasksCount,
+                    const size_t& vThreadsCount,
+                    const std::function<void(size_t vTaskIdx, size_t vThreadIdx)>& vTask,
+                    const std::function<void()>& vWaitCallback = nullptr) {
+        if (vTasksCount == 0U || !vTask) {
+            return;
+        }
+        const size_t threads_count = std::max<size_t>(1U, std::min(vThreadsCount, vTasksCount));
+        std::atomic<size_t> next_task(0U);
+        std::atomic<size_t> done_threads(0U);
+        auto worker = [&](size_t vThreadIdx) {
+            size_t task_idx = next_task++;
+            while (task_idx < vTasksCount) {
+                vTask(task_idx, vThreadIdx);
+                task_idx = next_task++;
+            }
+            ++done_threads;
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(threads_count);
+        for (size_t idx = 0U; idx < threads_count; ++idx) {
+            threads.emplace_back(worker, idx);
+        }
+        while (done_threads < threads_count) {
+            if (vWaitCallback) {
+                vWaitCallback();
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+};